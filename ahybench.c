@@ -0,0 +1,90 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* ahybench.c - CORDIC asnh, acnh and atnh against the ln forms        */
+/*   The old forms (spfln of x + spfsqr(...) and of a quotient) are     */
+/*   kept here as oldasn, oldacn and oldatn.  Prints each beside its    */
+/*   old form with the spread in ulp: asnh(x) and acnh(1 + x) over a    */
+/*   sweep from 2^-10 by steps of 2^(1/2), and atnh(x) while x < 1.     */
+/*   Small x is where the old forms lost bits to 1 + x.  Then each      */
+/*   runs NREP times; time the pairs between the go/end lines.          */
+
+#define NSWP    40L
+#define NREP    100L
+#define C_1K    0x3a800000L     /* 2^-10 */
+#define C_STEP  0x3fb504f3L     /* 2^(1/2) */
+
+spf     oldasn(x)
+spf     x;
+{
+        return spfln(spfadd(x,spfsqr(spfadd(spfmul(x,x),spfone))));
+}
+
+spf     oldacn(x)
+spf     x;
+{
+        return spfln(spfadd(x,spfsqr(spfmul(spfsub(x,spfone),
+                spfadd(x,spfone)))));
+}
+
+spf     oldatn(x)
+spf     x;
+{
+        return spfmul(spfhlf,spfln(spfdiv(spfadd(spfone,x),
+                spfsub(spfone,x))));
+}
+
+void    main()
+{
+spf     x;
+spf     y;
+spf     a;
+spf     b;
+spf     s;
+long    i;
+long    k;
+
+        printf("    x       asnh    old     ulp   acnh(1+x) old   ulp   ");
+        printf("atnh    old     ulp\n");
+        x=C_1K;
+        for(i=0L;i<NSWP;i++) {
+                a=asnh(x);
+                b=oldasn(x);
+                printf("%08lX  %08lX %08lX %4ld  ",x,a,b,udist(a,b));
+                y=spfadd(spfone,x);
+                a=acnh(y);
+                b=oldacn(y);
+                printf("%08lX %08lX %4ld",a,b,udist(a,b));
+                if(x<spfone) {
+                        a=atnh(x);
+                        b=oldatn(x);
+                        printf("  %08lX %08lX %4ld",a,b,udist(a,b));
+                }
+                printf("\n");
+                x=spfmul(x,C_STEP);
+        }
+
+        /* timing */
+        x=0x3f333333L;                  /* 0.7 */
+        y=0x40133333L;                  /* 2.3 */
+        go("asnh");
+        for(k=0L;k<NREP;k++) s=asnh(y);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldasn(y);
+        end();
+        go("acnh");
+        for(k=0L;k<NREP;k++) s=acnh(y);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldacn(y);
+        end();
+        go("atnh");
+        for(k=0L;k<NREP;k++) s=atnh(x);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldatn(x);
+        end();
+}
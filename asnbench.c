@@ -0,0 +1,88 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* asnbench.c - spfasn and spfacs against the forms built from atan    */
+/*   asin x = atan(x / sqrt(1 - x*x)) and acos x = pi/2 - asin x,    */
+/*   printed over a sweep of [-1, 1] and close to 1 with the spread   */
+/*   between them in ulp.  Then each runs NREP times; time the pairs  */
+/*   between the go/end lines.  q2asn cycles are in the spfcrd.s      */
+/*   header.                                                          */
+
+#define NSWP    16L
+#define NREP    50L
+#define C_1_8   0x3e000000L     /* 1/8 */
+
+spf     asnc(x)
+spf     x;
+{
+        return spfatn(spfdiv(x,spfsqr(spfsub(spfone,spfmul(x,x)))));
+}
+
+spf     acsc(x)
+spf     x;
+{
+        return spfsub(spfmul(spfpi,spfhlf),asnc(x));
+}
+
+void    row(x)
+spf     x;
+{
+spf     a;
+spf     b;
+spf     c;
+spf     d;
+
+        a=spfasn(x);
+        b=asnc(x);
+        c=spfacs(x);
+        d=acsc(x);
+        printf("%08lX  %08lX %08lX %5ld   %08lX %08lX %5ld\n",
+                x,a,b,udist(a,b),c,d,udist(c,d));
+}
+
+void    main()
+{
+spf     x;
+spf     d;
+spf     s;
+long    i;
+long    k;
+
+        printf("    x      spfasn   atan form  ulp    spfacs   atan form  ulp\n");
+        x=spfneg(spfone);
+        x=spfadd(x,C_1_8);
+        for(i=1L;i<NSWP;i++) {
+                row(x);
+                x=spfadd(x,C_1_8);
+        }
+        /* 1 - 2^-k: acos goes to 0, asin to pi/2 */
+        d=C_1_8;
+        for(i=0L;i<6L;i++) {
+                d=spfmul(d,C_1_8);
+                row(spfsub(spfone,d));
+        }
+
+        /* timing */
+        x=0x3f3504f3L;                  /* 1/sqrt(2) */
+        go("spfasn");
+        for(k=0L;k<NREP;k++) s=spfasn(x);
+        end();
+        go("atan");
+        for(k=0L;k<NREP;k++) s=asnc(x);
+        end();
+        go("spfacs");
+        for(k=0L;k<NREP;k++) s=spfacs(x);
+        end();
+        go("atan");
+        for(k=0L;k<NREP;k++) s=acsc(x);
+        end();
+        x=0x3f7ffff0L;                  /* 1 - 2^-20 */
+        go("spfacs");
+        for(k=0L;k<NREP;k++) s=spfacs(x);
+        end();
+        go("atan");
+        for(k=0L;k<NREP;k++) s=acsc(x);
+        end();
+}
@@ -191,12 +191,101 @@ static void swaxes()
     printf("\n");
 }
 
+static void swpol()
+{
+    long deg;
+    spf th;
+    spf x;
+    spf y;
+    spf r;
+    spf t;
+    spf h;
+    spf rad;
+    char bR[32];
+
+    printf("POLAR: spfpol(x, y) with x, y = 2.5 (cos, sin), -165..180 deg, step 15\n");
+    printf("  r against spfhyp, theta against spfa2 and the angle\n");
+    printf("  deg   r (dec)          hex        spfhyp     theta      spfa2      err(hex)\n");
+    printf("-------------------------------------------------------------------------------\n");
+
+    rad = 0x40200000L;                     /* 2.5 */
+    for (deg = -165; deg <= 180; deg += 15) {
+        th = spfdtr(spfltf(deg));
+        x  = spfmul(rad, spfcos(th));
+        y  = spfmul(rad, spfsin(th));
+        spfpol(x, y, &r, &t);
+        h  = spfhyp(x, y);
+
+        pf(bR, r, 7L);
+
+        printf(" %4ld   %-16s ", deg, bR);
+        phex(r);
+        printf("   "); phex(h);
+        printf("   "); phex(t);
+        printf("   "); phex(spfa2(y, x));
+        printf("   "); phex(spfsub(t, th));
+        printf("\n");
+    }
+    printf("\n");
+}
+
+static void swrot()
+{
+    long deg;
+    spf th;
+    spf x;
+    spf y;
+    spf xo;
+    spf yo;
+    spf xs;
+    spf ys;
+    spf s;
+    spf c;
+    char bX[32];
+    char bY[32];
+
+    printf("ROTATE: spfrot(3, 4, theta), theta = -360..360 deg, step 45\n");
+    printf("  against x cos - y sin, x sin + y cos (spfsin, spfcos, 4 spfmul)\n");
+    printf("  deg   xo (dec)        yo (dec)         xo hex     yo hex     xerr       yerr\n");
+    printf("--------------------------------------------------------------------------------\n");
+
+    x = 0x40400000L;                       /* 3 */
+    y = 0x40800000L;                       /* 4 */
+    for (deg = -360; deg <= 360; deg += 45) {
+        th = spfdtr(spfltf(deg));
+        spfrot(x, y, th, &xo, &yo);
+        s  = spfsin(th);
+        c  = spfcos(th);
+        xs = spfsub(spfmul(x, c), spfmul(y, s));
+        ys = spfadd(spfmul(x, s), spfmul(y, c));
+
+        pf(bX, xo, 6L);
+        pf(bY, yo, 6L);
+
+        printf(" %4ld   %-15s %-15s  ", deg, bX, bY);
+        phex(xo);
+        printf("   "); phex(yo);
+        printf("   "); phex(spfsub(xo, xs));
+        printf("   "); phex(spfsub(yo, ys));
+        printf("\n");
+    }
+    spfrot(x, y, spfz, &xo, &yo);
+    printf("  a = 0                                  "); phex(xo);
+    printf("   "); phex(yo); printf("\n");
+    spfrot(spfz, spfz, spfpi, &xo, &yo);
+    printf("  (0,0)                                  "); phex(xo);
+    printf("   "); phex(yo); printf("\n");
+    printf("\n");
+}
+
 int main()
 {
     headr();
     swth();
     swrat();
     swaxes();
+    swpol();
+    swrot();
     return 0;
 }
 
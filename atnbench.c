@@ -0,0 +1,55 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* atnbench.c - atpoly (spfscp.s) against the CORDIC spfatt, the two    */
+/*   atan engines.  Prints both over a sweep of [1/16, 16] with the     */
+/*   spread between them in ulp, then runs each NREP times; time the    */
+/*   pairs between the go/end lines.  Error and cycle tables are in the */
+/*   spfscp.s header.                                                   */
+
+#define NSWP    32L
+#define NREP    200L
+#define C_1_16  0x3d800000L     /* 1/16 */
+#define C_Q     0x3f9837f0L     /* 2^(1/4) */
+
+spf     atpoly();
+
+void    main()
+{
+spf     a;
+spf     p;
+spf     c;
+long    i;
+long    k;
+
+        printf("    a      atpoly   spfatt    ulp\n");
+        a=C_1_16;
+        for(i=0L;i<=NSWP;i++) {
+                p=atpoly(a);
+                c=spfatt(a,SPFTHI);
+                printf("%08lX  %08lX %08lX %5ld\n",a,p,c,udist(p,c));
+                a=spfmul(a,C_Q);
+        }
+        a=0x3c23d70aL;                  /* 0.01: the small path */
+        p=atpoly(a);
+        c=spfatt(a,SPFTHI);
+        printf("%08lX  %08lX %08lX %5ld\n",a,p,c,udist(p,c));
+
+        /* timing */
+        a=0x3f13cd3aL;                  /* tan(30 deg) */
+        go("atpoly");
+        for(k=0L;k<NREP;k++) p=atpoly(a);
+        end();
+        go("spfatt");
+        for(k=0L;k<NREP;k++) p=spfatt(a,SPFTHI);
+        end();
+        a=0x40400000L;                  /* 3 */
+        go("atpoly");
+        for(k=0L;k<NREP;k++) p=atpoly(a);
+        end();
+        go("spfatt");
+        for(k=0L;k<NREP;k++) p=spfatt(a,SPFTHI);
+        end();
+}
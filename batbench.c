@@ -0,0 +1,121 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* batbench.c - array sin/cos/exp/ln against the scalar calls, the      */
+/*   phase oscillator against spfsc, and timing runs                    */
+/*   spvsc, spvsin, spvcos, spvexp and spvln must match spfsc, spfexp   */
+/*   and spfln bit for bit.  The oscillator runs NOSC samples of a step */
+/*   1/64 (every angle k/64 is exact in spf) and prints its largest     */
+/*   distance from spfsc in units of 2^-30.  Then time the pairs        */
+/*   between the go/end lines; spfosn cycles are in the spfosc.s header.*/
+
+#define NVEC    64
+#define NOSC    1000L
+#define NREP    20L
+#define C_01    0x3c23d70aL     /* 0.01 */
+#define C_64TH  0x3c800000L     /* 1/64 */
+#define P2_30   0x4E800000L     /* 2^30 */
+
+spf     va[NVEC];
+spf     vs[NVEC];
+spf     vc[NVEC];
+spf     sr[NVEC];
+spf     cr[NVEC];
+long    bad;
+
+void    same(lbl, r, t)
+char    *lbl;
+spf     *r;
+spf     *t;
+{
+long    i;
+long    n;
+
+        n=0L;
+        for(i=0L;i<NVEC;i++) if(r[i]!=t[i]) n++;
+        printf("%-8s %s\n", lbl, (n==0L) ? "ok" : "FAIL");
+        if(n!=0L) bad++;
+}
+
+void    main()
+{
+SPFOSC  o;
+spf     a;
+spf     s;
+spf     c;
+spf     sc;
+spf     cc;
+spf     e;
+spf     emax;
+long    i;
+long    k;
+
+        bad=0L;
+        /* angles -6.4 .. 6.2 */
+        for(i=0L;i<NVEC;i++) va[i]=spfmul(spfltf(i*20L-640L),C_01);
+        spvsc(vs,vc,va,(long)NVEC);
+        for(i=0L;i<NVEC;i++) spfsc(va[i],&sr[i],&cr[i]);
+        same("spvsc s",vs,sr);
+        same("spvsc c",vc,cr);
+        spvsin(vs,va,(long)NVEC);
+        same("spvsin",vs,sr);
+        spvcos(vc,va,(long)NVEC);
+        same("spvcos",vc,cr);
+        /* exp over -8 .. 8, slowly rising like a sensor input */
+        for(i=0L;i<NVEC;i++) va[i]=spfmul(spfltf(i*25L-800L),C_01);
+        spvexp(vs,va,(long)NVEC);
+        for(i=0L;i<NVEC;i++) sr[i]=spfexp(va[i]);
+        same("spvexp",vs,sr);
+        /* ln over 0.01 .. 40.33, and 0 */
+        for(i=0L;i<NVEC;i++) va[i]=spfmul(spfltf(i*i+1L),C_01);
+        va[0]=spfz;
+        spvln(vs,va,(long)NVEC);
+        for(i=0L;i<NVEC;i++) sr[i]=spfln(va[i]);
+        same("spvln",vs,sr);
+
+        /* oscillator against spfsc at k/64 */
+        spfosi(&o,spfz,C_64TH);
+        emax=spfz;
+        a=spfz;
+        for(k=0L;k<NOSC;k++) {
+                spfosn(&o,&s,&c);
+                spfsc(a,&sc,&cc);
+                e=spfabs(spfsub(s,sc));
+                if(spfgt(e,emax)) emax=e;
+                e=spfabs(spfsub(c,cc));
+                if(spfgt(e,emax)) emax=e;
+                a=spfadd(a,C_64TH);
+        }
+        printf("spfosn   %ld samples, largest error %ld * 2^-30\n",
+                NOSC,spflng(spfmul(emax,P2_30)));
+        printf("done, %ld failures\n",bad);
+
+        /* timing, NREP * NVEC elements each */
+        for(i=0L;i<NVEC;i++) va[i]=spfmul(spfltf(i*20L-640L),C_01);
+        go("spvsc");
+        for(k=0L;k<NREP;k++) spvsc(vs,vc,va,(long)NVEC);
+        end();
+        go("spfsc");
+        for(k=0L;k<NREP;k++) for(i=0L;i<NVEC;i++) spfsc(va[i],&vs[i],&vc[i]);
+        end();
+        go("spfosn");
+        spfosi(&o,va[0],spfmul(spfltf(20L),C_01));
+        for(k=0L;k<NREP;k++) for(i=0L;i<NVEC;i++) spfosn(&o,&vs[i],&vc[i]);
+        end();
+        for(i=0L;i<NVEC;i++) va[i]=spfmul(spfltf(i*25L-800L),C_01);
+        go("spvexp");
+        for(k=0L;k<NREP;k++) spvexp(vs,va,(long)NVEC);
+        end();
+        go("spfexp");
+        for(k=0L;k<NREP;k++) for(i=0L;i<NVEC;i++) vs[i]=spfexp(va[i]);
+        end();
+        for(i=0L;i<NVEC;i++) va[i]=spfmul(spfltf(i*i+1L),C_01);
+        go("spvln");
+        for(k=0L;k<NREP;k++) spvln(vs,va,(long)NVEC);
+        end();
+        go("spfln");
+        for(k=0L;k<NREP;k++) for(i=0L;i<NVEC;i++) vs[i]=spfln(va[i]);
+        end();
+}
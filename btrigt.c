@@ -1,7 +1,8 @@
 /* btrigt.c - Full-circle trig tests for CP/M-68K (no brace initializers)
  *
  * Sections:
- *  1) Sine/Cosine table for 0..360 degrees, step 3
+ *  1) Sine/Cosine table for 0..360 degrees, step 3 (spfsc must
+ *     match spfsin/spfcos bit for bit)
  *  2) Tangent table for -90..+90 degrees, step 3 (skips +/-90)
  *
  * Prints angles (deg), radians (hex), and function outputs (hex).
@@ -36,23 +37,25 @@ long d;
 void sctest()
 {
     long deg;
-    spf a, s, c;
+    spf a, s, c, s2, c2;
 
     printf("SINE/COSINE  (0..360 deg, step 3)\n");
-    printf(" deg  rad(hex)   sin(spf)  cos(spf)\n");
-    printf("------------------------------------\n");
+    printf(" deg  rad(hex)   sin(spf)  cos(spf)  spfsc\n");
+    printf("-------------------------------------------\n");
 
     deg = 0L;
     while (deg <= 360L) {
         a = d2rad(deg);
         s = spfsin(a);
         c = spfcos(a);
+        spfsc(a, &s2, &c2);
 
-        printf("%4ld  %08lX  %08lX  %08lX\n",
+        printf("%4ld  %08lX  %08lX  %08lX  %s\n",
                deg,
                (unsigned long)a,
                (unsigned long)s,
-               (unsigned long)c);
+               (unsigned long)c,
+               (s2 == s && c2 == c) ? "ok" : "FAIL");
 
         deg = deg + STEP;
     }
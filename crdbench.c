@@ -0,0 +1,141 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* crdbench.c - spfcrd.s q2rot against the C CORDIC loop, and timing runs */
+/*   Every angle in a sweep of [0, pi/4] must give the same x, y and z  */
+/*   from both.  Then each runs NREP times; time the pairs between the  */
+/*   go/end lines, and the same for the spfsct and spfatt tiers.        */
+/*   Simulator cycle counts are in the commit that added spfcrd.s.      */
+
+#define NCORD   26
+#define NANG    100L
+#define NREP    200L
+#define C_PI4   0x3f490fdbL     /* pi/4 */
+
+extern q2d atntb[];
+void    q2rot();
+void    q2asgn();
+void    q2add();
+void    q2sub();
+void    q2shr();
+
+long    bad;
+
+/* the loop cord8 ran before spfcrd.s */
+void    crdc(x, y, z)
+q2d     *x;
+q2d     *y;
+q2d     *z;
+{
+q2d     xn;
+q2d     yn;
+q2d     t1;
+q2d     t2;
+WORD    i;
+
+        for(i=0;i<NCORD;i++) {
+                q2asgn(&xn,x);
+                q2asgn(&yn,y);
+                if(z->hi<0L) {
+                        q2shr(&t1,&yn,(long)i);
+                        q2add(x,&xn,&t1);
+                        q2shr(&t2,&xn,(long)i);
+                        q2sub(y,&yn,&t2);
+                        q2add(z,z,&atntb[i]);
+                } else {
+                        q2shr(&t1,&yn,(long)i);
+                        q2sub(x,&xn,&t1);
+                        q2shr(&t2,&xn,(long)i);
+                        q2add(y,&yn,&t2);
+                        q2sub(z,z,&atntb[i]);
+                }
+        }
+}
+
+void    crdset(x, y, z, a)
+q2d     *x;
+q2d     *y;
+q2d     *z;
+spf     a;
+{
+        fpq2d(z,a);
+        x->hi=0x26DD3B6AL;
+        x->lo=0x10D7969AL;
+        y->hi=0L;
+        y->lo=0L;
+}
+
+long    q2same(a, b)
+q2d     *a;
+q2d     *b;
+{
+        return (a->hi==b->hi && a->lo==b->lo) ? 1L : 0L;
+}
+
+void    main()
+{
+q2d     x;
+q2d     y;
+q2d     z;
+q2d     xc;
+q2d     yc;
+q2d     zc;
+spf     a;
+spf     da;
+spf     s;
+spf     c;
+long    i;
+long    k;
+
+        bad=0L;
+        da=spfdiv(C_PI4,spfltf(NANG));
+        a=spfz;
+        for(i=0L;i<=NANG;i++) {
+                crdset(&x,&y,&z,a);
+                crdset(&xc,&yc,&zc,a);
+                q2rot(&x,&y,&z,(long)NCORD);
+                crdc(&xc,&yc,&zc);
+                if(!q2same(&x,&xc) || !q2same(&y,&yc) || !q2same(&z,&zc)) {
+                        printf("%08lX  x %08lX%08lX  C %08lX%08lX  FAIL\n",
+                                a,x.hi,x.lo,xc.hi,xc.lo);
+                        bad++;
+                }
+                a=spfadd(a,da);
+        }
+        printf("q2rot    %ld angles, %ld failures\n",NANG+1L,bad);
+
+        /* timing */
+        a=0x3f060a92L;                  /* pi/6 */
+        go("q2rot");
+        for(k=0L;k<NREP;k++) {
+                crdset(&x,&y,&z,a);
+                q2rot(&x,&y,&z,(long)NCORD);
+        }
+        end();
+        go("C loop");
+        for(k=0L;k<NREP;k++) {
+                crdset(&x,&y,&z,a);
+                crdc(&x,&y,&z);
+        }
+        end();
+        go("spfsc");
+        for(k=0L;k<NREP;k++) spfsc(a,&s,&c);
+        end();
+        go("SPFTMD");
+        for(k=0L;k<NREP;k++) spfsct(a,&s,&c,SPFTMD);
+        end();
+        go("SPFTLO");
+        for(k=0L;k<NREP;k++) spfsct(a,&s,&c,SPFTLO);
+        end();
+        go("spfatn");
+        for(k=0L;k<NREP;k++) s=spfatn(a);
+        end();
+        go("SPFTMD");
+        for(k=0L;k<NREP;k++) s=spfatt(a,SPFTMD);
+        end();
+        go("SPFTLO");
+        for(k=0L;k<NREP;k++) s=spfatt(a,SPFTLO);
+        end();
+}
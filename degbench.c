@@ -0,0 +1,86 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* degbench.c - spfdsc, spfpsc and spfbsc, the exact-reduction trig,    */
+/*   against spfdtr followed by spfsc.  Prints sin and cos both ways    */
+/*   every 15 degrees to 360 and at a few large angles, where rounding  */
+/*   d * pi/180 before the reduction shows.  16-bit encoder counts at  */
+/*   each 22.5 degrees through spfbsc must give what spfdsc gives.     */
+/*   Then each runs NREP times; time the groups between the go/end      */
+/*   lines.                                                              */
+
+#define NREP    200L
+#define C_15    0x41700000L     /* 15 */
+#define C_1_12  0x3daaaaabL     /* 1/12 */
+#define C_22_5  0x41b40000L     /* 22.5 */
+
+long    big[4] = {
+        0x47c35000L,            /* 100000 */
+        0x49742400L,            /* 1000000 */
+        0x4e6e6b28L,            /* 1e9 */
+        0x43b3ffffL             /* 359.99997 */
+};
+
+void    row(d)
+spf     d;
+{
+spf     s;
+spf     c;
+spf     sr;
+spf     cr;
+
+        spfdsc(d,&s,&c);
+        spfsc(spfdtr(d),&sr,&cr);
+        printf("%08lX  %08lX %08lX  %08lX %08lX\n",d,s,c,sr,cr);
+}
+
+void    main()
+{
+spf     d;
+spf     s;
+spf     c;
+spf     sb;
+spf     cb;
+long    i;
+long    k;
+long    b;
+
+        printf("    deg    spfdsc sin/cos     spfdtr+spfsc\n");
+        d=spfz;
+        for(i=0L;i<=24L;i++) {
+                row(d);
+                d=spfadd(d,C_15);
+        }
+        for(i=0L;i<4L;i++) row(big[i]);
+
+        /* encoder: 65536 counts to the turn, 4096 to 22.5 degrees */
+        k=0L;
+        d=spfz;
+        for(i=0L;i<16L;i++) {
+                b=(i*4096L)<<16;
+                spfbsc(b,&sb,&cb);
+                spfdsc(d,&s,&c);
+                if(sb!=s || cb!=c) k++;
+                d=spfadd(d,C_22_5);
+        }
+        printf("spfbsc   %ld of 16 differ from spfdsc\n",k);
+        spfpsc(C_1_12,&s,&c);
+        printf("spfpsc   pi/12 %08lX %08lX\n",s,c);
+
+        /* timing */
+        d=0x43a80000L;                  /* 336 */
+        go("spfdsc");
+        for(k=0L;k<NREP;k++) spfdsc(d,&s,&c);
+        end();
+        go("dtr+sc");
+        for(k=0L;k<NREP;k++) spfsc(spfdtr(d),&s,&c);
+        end();
+        go("spfpsc");
+        for(k=0L;k<NREP;k++) spfpsc(C_1_12,&s,&c);
+        end();
+        go("spfbsc");
+        for(k=0L;k<NREP;k++) spfbsc(0xEEEE0000L,&s,&c);
+        end();
+}
@@ -0,0 +1,67 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+
+/* divtest.c - spfdiv/spfrcp spot checks (rounding, overflow, underflow, specials, flags) */
+
+#define NDIV    11
+#define NRCP    3
+
+spf     op1[NDIV];
+spf     op2[NDIV];
+spf     want[NDIV];
+spf     rop[NRCP];
+spf     rwant[NRCP];
+
+void    divset()
+{
+        op1[0]=spfone;          op2[0]=0x40400000L;     want[0]=0x3eaaaaabL;    /* 1/3 round up */
+        op1[1]=spfpi;           op2[1]=spfpi2;          want[1]=spftwo;         /* exact */
+        op1[2]=spfone;          op2[2]=0x3f800001L;     want[2]=0x3f7ffffeL;    /* round down */
+        op1[3]=0x3fffffffL;     op2[3]=0x3f800001L;     want[3]=0x3ffffffdL;
+        op1[4]=0xc1100000L;     op2[4]=0x40400000L;     want[4]=0xc0400000L;    /* -9/3 */
+        op1[5]=0x7f000000L;     op2[5]=spfhlf;          want[5]=0x7f800000L;    /* overflow */
+        op1[6]=0x00800000L;     op2[6]=spftwo;          want[6]=spfz;           /* underflow */
+        op1[7]=0x7f800000L;     op2[7]=0x7f800000L;     want[7]=spfNAN;         /* inf/inf */
+        op1[8]=spfone;          op2[8]=spfz;            want[8]=spfNAN;         /* x/0 */
+        op1[9]=spfz;            op2[9]=0x40400000L;     want[9]=spfz;           /* 0/y */
+        op1[10]=spfone;         op2[10]=0x7f800000L;    want[10]=spfz;          /* x/inf */
+        rop[0]=0x40400000L;     rwant[0]=0x3eaaaaabL;                           /* 1/3 */
+        rop[1]=spfhlf;          rwant[1]=spftwo;
+        rop[2]=0xc0a00000L;     rwant[2]=0xbe4ccccdL;                           /* -1/5 */
+}
+
+void    main()
+{
+spf     res;
+long    i;
+long    bad;
+
+        divset();
+        bad=0L;
+        for(i=0L;i<NDIV;i++) {
+                res=spfdiv(op1[i],op2[i]);
+                printf("%08lX / %08lX = %08lX  %s\n",op1[i],op2[i],res,
+                        (res==want[i]) ? "ok" : "FAIL");
+                if(res!=want[i]) bad++;
+        }
+        for(i=0L;i<NRCP;i++) {
+                res=spfrcp(rop[i]);
+                printf("1 / %08lX = %08lX  %s\n",rop[i],res,
+                        (res==rwant[i]) ? "ok" : "FAIL");
+                if(res!=rwant[i]) bad++;
+        }
+        /* sticky flags */
+        spfclr(SPFALL);
+        res=spfdiv(0x40c00000L,0x40400000L);                    /* 6/3 exact */
+        if(spftst(SPFALL)!=0L) { printf("6/3 raised %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        res=spfdiv(spfone,0x40400000L);                         /* 1/3 */
+        if(spftst(SPFALL)!=SPFINX) { printf("1/3 flags %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        res=spfdiv(spfone,spfz);
+        res=spfdiv(0x7f000000L,spfhlf);
+        if(spftst(SPFDZ|SPFOVF)!=(SPFDZ|SPFOVF)) { printf("x/0, overflow flags %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        spfclr(SPFDZ);
+        if(spftst(SPFALL)!=(SPFOVF|SPFINX)) { printf("spfclr left %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        spfclr(SPFALL);
+        printf("done, %ld failures\n",bad);
+}
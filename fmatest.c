@@ -0,0 +1,55 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+
+/* fmatest.c - spffma spot checks (single rounding, cancellation, specials, flags) */
+
+#define NFMA    12
+
+spf     op1[NFMA];
+spf     op2[NFMA];
+spf     op3[NFMA];
+spf     want[NFMA];
+
+void    fmaset()
+{
+        op1[0]=0x3e2aaaabL;     op2[0]=spfhlf;          op3[0]=spfone;          want[0]=0x3f8aaaabL;    /* 1/6*0.5+1 */
+        op1[1]=0x3f800001L;     op2[1]=0x3f800001L;     op3[1]=0xbf800002L;     want[1]=0x28800000L;    /* 2^-46 kept */
+        op1[2]=0x3fa00000L;     op2[2]=0x40400000L;     op3[2]=spfone;          want[2]=0x40980000L;    /* 1.25*3+1 */
+        op1[3]=0x40400000L;     op2[3]=0x40400000L;     op3[3]=0xc1100000L;     want[3]=spfz;           /* 3*3-9 */
+        op1[4]=0x3f800001L;     op2[4]=0x3f7fffffL;     op3[4]=spfn1;           want[4]=0x337ffffeL;
+        op1[5]=0x7f000000L;     op2[5]=spftwo;          op3[5]=spfone;          want[5]=0x7f800000L;    /* overflow */
+        op1[6]=0x00800000L;     op2[6]=spfhlf;          op3[6]=spfz;            want[6]=spfz;           /* underflow */
+        op1[7]=0x7f800000L;     op2[7]=spfone;          op3[7]=0xff800000L;     want[7]=spfNAN;         /* inf-inf */
+        op1[8]=0x7f800000L;     op2[8]=spfz;            op3[8]=spfone;          want[8]=spfNAN;         /* inf*0 */
+        op1[9]=spfz;            op2[9]=0x40400000L;     op3[9]=0xc0000000L;     want[9]=0xc0000000L;    /* 0*3-2 */
+        op1[10]=spfone;         op2[10]=spfone;         op3[10]=0x33800000L;    want[10]=spfone;        /* tie to even */
+        op1[11]=spfone;         op2[11]=spfone;         op3[11]=0x33800001L;    want[11]=0x3f800001L;   /* past the tie */
+}
+
+void    main()
+{
+spf     res;
+long    i;
+long    bad;
+
+        fmaset();
+        bad=0L;
+        for(i=0L;i<NFMA;i++) {
+                res=spffma(op1[i],op2[i],op3[i]);
+                printf("%08lX * %08lX + %08lX = %08lX  %s\n",op1[i],op2[i],op3[i],res,
+                        (res==want[i]) ? "ok" : "FAIL");
+                if(res!=want[i]) bad++;
+        }
+        /* sticky flags */
+        spfclr(SPFALL);
+        res=spffma(0x40400000L,0x40400000L,0xc1100000L);       /* 3*3-9 exact */
+        if(spftst(SPFALL)!=0L) { printf("3*3-9 raised %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        res=spffma(0x3e2aaaabL,spfhlf,spfone);
+        if(spftst(SPFALL)!=SPFINX) { printf("1/6*0.5+1 flags %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        spfclr(SPFALL);
+        res=spffma(0x7f800000L,spfz,spfone);
+        if(spftst(SPFALL)!=SPFINV) { printf("inf*0 flags %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        spfclr(SPFALL);
+        printf("done, %ld failures\n",bad);
+}
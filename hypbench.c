@@ -0,0 +1,74 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* hypbench.c - hyperbolic CORDIC against the e^x forms it replaced     */
+/*   The old hypair (spfexp, one divide for e^-x, two roundings) is     */
+/*   kept here as oldshc.  Prints sinh and cosh beside it over a sweep  */
+/*   from 2^-10 by steps of 2^(1/2), with the spread in ulp; sinh of    */
+/*   small x is where the old form lost bits to e^x - e^-x.  Then       */
+/*   spfexh beside spfexp, which should agree to an ulp.  Each runs     */
+/*   NREP times; time the pairs between the go/end lines.               */
+
+#define NSWP    36L
+#define NREP    100L
+#define C_1K    0x3a800000L     /* 2^-10 */
+#define C_STEP  0x3fb504f3L     /* 2^(1/2) */
+#define C_HLF   0x3f000000L     /* 0.5 */
+
+void    oldshc(x, ps, pc)
+spf     x;
+spf     *ps;
+spf     *pc;
+{
+spf     e;
+spf     ei;
+
+        e=spfexp(x);
+        ei=spfdiv(spfone,e);
+        *ps=spfmul(C_HLF,spfsub(e,ei));
+        *pc=spfmul(C_HLF,spfadd(e,ei));
+}
+
+void    main()
+{
+spf     x;
+spf     s;
+spf     c;
+spf     so;
+spf     co;
+spf     a;
+spf     b;
+long    i;
+long    k;
+
+        printf("    x       sinh    old     ulp   cosh    old     ulp   ");
+        printf("spfexh  spfexp  ulp\n");
+        x=C_1K;
+        for(i=0L;i<NSWP;i++) {
+                hypair(x,&s,&c);
+                oldshc(x,&so,&co);
+                a=spfexh(x);
+                b=spfexp(x);
+                printf("%08lX  %08lX %08lX %4ld  %08lX %08lX %4ld  ",
+                        x,s,so,udist(s,so),c,co,udist(c,co));
+                printf("%08lX %08lX %ld\n",a,b,udist(a,b));
+                x=spfmul(x,C_STEP);
+        }
+
+        /* timing */
+        x=0x40133333L;                  /* 2.3 */
+        go("hypair");
+        for(k=0L;k<NREP;k++) hypair(x,&s,&c);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) oldshc(x,&s,&c);
+        end();
+        go("spfexh");
+        for(k=0L;k<NREP;k++) a=spfexh(x);
+        end();
+        go("spfexp");
+        for(k=0L;k<NREP;k++) a=spfexp(x);
+        end();
+}
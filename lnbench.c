@@ -0,0 +1,132 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* lnbench.c - the lg2tb log2 core against the atanh series it replaced */
+/*   The old spfln (e ln2 plus the mantissa series, two roundings)      */
+/*   is kept here as oldln, with spflog and spflg2 as divisions of it.  */
+/*   Prints spfln, spflog and spflg2 beside the old forms over a sweep  */
+/*   from 2^-20 by steps of 2^(3/4), with the spread in ulp; log2 of a  */
+/*   power of 2 must be exact.  Then each runs NREP times; time the     */
+/*   pairs between the go/end lines.                                    */
+
+#define NSWP    40L
+#define NREP    200L
+#define C_1M    0x35800000L     /* 2^-20 */
+#define C_STEP  0x3fd744fdL     /* 2^(3/4) */
+
+spx     lnc[6];                 /* 1/3 .. 1/13 */
+spx     one;
+spx     two;
+long    bad;
+
+/* the atanh series spfefn.c ran before lg2tb, x in [1, 2) */
+spf     oldser(x)
+spf     x;
+{
+spx     r;
+spx     z;
+spx     z2;
+spx     t;
+int     i;
+
+        fpspx(&r,x);
+        spxsub(&r,&r,&one);
+        spxadd(&t,&two,&r);
+        spxdiv(&z,&r,&t);
+        spxmul(&z2,&z,&z);
+        spxfma(&t,&lnc[5],&z2,&lnc[4]);
+        for(i=3;i>=0;i--) spxfma(&t,&t,&z2,&lnc[i]);
+        spxmul(&r,&z,&z2);
+        spxfma(&t,&r,&t,&z);
+        if(t.man!=0L) t.expo++;
+        return spx_fp(&t);
+}
+
+spf     oldln(x)
+spf     x;
+{
+long    e;
+spf     m;
+
+        e=((x>>23)&0xFFL)-127L;
+        m=(x&0x007FFFFFL)|0x3F800000L;
+        if(m==spfone) return spfmul(spfltf(e),spfl2);
+        return spfadd(spfmul(spfltf(e),spfl2),oldser(m));
+}
+
+spf     oldlog(x)
+spf     x;
+{
+        return spfdiv(oldln(x),spfl10);
+}
+
+spf     oldlg2(x)
+spf     x;
+{
+        return spfdiv(oldln(x),spfl2);
+}
+
+void    main()
+{
+spx     t;
+spf     x;
+spf     a;
+spf     b;
+spf     s;
+long    i;
+long    k;
+
+        bad=0L;
+        fpspx(&one,spfone);
+        fpspx(&two,spfltf(2L));
+        for(i=0L;i<6L;i++) {
+                fpspx(&t,spfltf(2L*i+3L));
+                spxdiv(&lnc[i],&one,&t);
+        }
+
+        printf("    x      spfln    old    ulp   spflog   old    ulp   spflg2   old    ulp\n");
+        x=C_1M;
+        for(i=0L;i<NSWP;i++) {
+                printf("%08lX  ",x);
+                a=spfln(x);
+                b=oldln(x);
+                printf("%08lX %08lX %3ld  ",a,b,udist(a,b));
+                a=spflog(x);
+                b=oldlog(x);
+                printf("%08lX %08lX %3ld  ",a,b,udist(a,b));
+                a=spflg2(x);
+                b=oldlg2(x);
+                printf("%08lX %08lX %3ld\n",a,b,udist(a,b));
+                x=spfmul(x,C_STEP);
+        }
+        /* 2^-126 .. 2^127 */
+        k=0L;
+        for(i=-126L;i<128L;i++)
+                if(spflg2((i+127L)<<23)!=spfltf(i)) k++;
+        printf("spflg2   2^n %s\n",(k==0L) ? "exact" : "FAIL");
+        if(k!=0L) bad++;
+        printf("done, %ld failures\n",bad);
+
+        /* timing */
+        x=0x40490fdbL;                  /* pi */
+        go("spfln");
+        for(k=0L;k<NREP;k++) s=spfln(x);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldln(x);
+        end();
+        go("spflog");
+        for(k=0L;k<NREP;k++) s=spflog(x);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldlog(x);
+        end();
+        go("spflg2");
+        for(k=0L;k<NREP;k++) s=spflg2(x);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldlg2(x);
+        end();
+}
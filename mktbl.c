@@ -0,0 +1,735 @@
+// MIT License
+// Copyright (c) 2025 John J Lovrinic
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+//--------------------------------------------------------
+// Title      : mktbl.c
+// Writes spftbl.s, the library's constant tables, as an
+// assembler data section that can live in ROM:
+//   atntb  atan(2^-i), i = 0..31, Q2.62 (CORDIC, spfatn)
+//   q2pi2  pi/2, Q2.62
+//   exptb  1/k!, k = 0..10, spx (exp series)
+//   lg2tb  c = n/128 with n = round(4096/j), and -log2 c,
+//          j = 23..45, spx (log2 core)
+//   lg2pc  (-1)^(k+1) / (k ln2), k = 1..6, spx (log2 series)
+//   lg2cv  ln2, log10(2), spx (ln and log10 from log2)
+//   fopi   bits of 4/pi (octred, spfred.s)
+//   sctb   sin and cos of k/32, k = 1..25, Q0.32 (scpoly)
+//   attb   atan(k/16), k = 1..16, Q2.62 (atpoly)
+//   athtb  atanh(2^-i), i = 1..31 with 4 and 13 twice, Q2.62
+//          (hyperbolic CORDIC, q2hyp)
+//   q2hki  1/K over the first 18 of those steps, Q2.62
+// Every value is computed in 256-bit fixed point from its
+// series and rounded to nearest.  Two independent routes to
+// pi/4 and to atan(1/2) must agree before anything is
+// written, every sin^2 + cos^2 of sctb must come to 1, and
+// attb must meet pi/4 and atan(1/2) at k = 16 and k = 8.
+// ln2 by two atanh routes must agree, and every quotient by
+// ln2 or ln10 is multiplied back; so is 1/K, squared.
+// Needs no spflib; run it on CP/M or any host:
+//   mktbl         (writes spftbl.s)
+//--------------------------------------------------------
+#include <stdio.h>
+
+#define NLIMB	17		// limb 0 integer, limbs 1..16 fraction
+#define NATN	32
+#define NEXP	11
+#define LG2J0	23		// log2 breakpoints j/32, j = LG2J0..LG2J1
+#define LG2J1	45
+#define NLG2C	6		// log2 series terms
+#define NFOPI	8		// longs of 4/pi bits
+#define NSCTB	25		// sin/cos breakpoints k/32, k = 1..NSCTB
+#define NATTB	16		// atan breakpoints k/16, k = 1..NATTB
+#define NATH	31		// atanh(2^-i), i = 1..NATH
+#define NHYR	18		// q2hki steps, as spft2.c runs q2hyp
+
+typedef unsigned long big[NLIMB];	// 16-bit limbs, most significant first
+
+FILE	*fo;
+
+void bclr(a)
+big a;
+{
+	int i;
+	for (i = 0; i < NLIMB; i++) a[i] = 0L;
+}
+
+// a = 2^-s, 0 <= s < 16*(NLIMB-1)
+void bpow2(a, s)
+big a;
+int s;
+{
+	bclr(a);
+	if (s == 0) a[0] = 1L;
+	else a[(s + 15) / 16] = 1L << (16 * ((s + 15) / 16) - s);
+}
+
+void bcpy(r, a)
+big r;
+big a;
+{
+	int i;
+	for (i = 0; i < NLIMB; i++) r[i] = a[i];
+}
+
+// r = r + a
+void badd(r, a)
+big r;
+big a;
+{
+	int i;
+	unsigned long c;
+	c = 0L;
+	for (i = NLIMB - 1; i >= 0; i--) {
+		c = r[i] + a[i] + c;
+		r[i] = c & 0xFFFFL;
+		c >>= 16;
+	}
+}
+
+// r = r - a
+void bsub(r, a)
+big r;
+big a;
+{
+	int i;
+	unsigned long b;
+	b = 0L;
+	for (i = NLIMB - 1; i >= 0; i--) {
+		b = r[i] - a[i] - b;
+		r[i] = b & 0xFFFFL;
+		b = (b >> 16) & 1L;
+	}
+}
+
+// a = a / d, 0 < d < 65536
+void bdiv(a, d)
+big a;
+unsigned long d;
+{
+	int i;
+	unsigned long n;
+	n = 0L;
+	for (i = 0; i < NLIMB; i++) {
+		n = (n << 16) | a[i];
+		a[i] = n / d;
+		n = n % d;
+	}
+}
+
+// a = a >> s
+void bshr(a, s)
+big a;
+int s;
+{
+	int i;
+	for (; s >= 16; s -= 16) {
+		for (i = NLIMB - 1; i > 0; i--) a[i] = a[i - 1];
+		a[0] = 0L;
+	}
+	if (s == 0) return;
+	for (i = NLIMB - 1; i > 0; i--)
+		a[i] = ((a[i] >> s) | (a[i - 1] << (16 - s))) & 0xFFFFL;
+	a[0] >>= s;
+}
+
+// a = a << 1
+void bshl1(a)
+big a;
+{
+	int i;
+	for (i = 0; i < NLIMB - 1; i++)
+		a[i] = ((a[i] << 1) | (a[i + 1] >> 15)) & 0xFFFFL;
+	a[NLIMB - 1] = (a[NLIMB - 1] << 1) & 0xFFFFL;
+}
+
+// a = a * m, 0 <= m < 65536
+void bmuls(a, m)
+big a;
+unsigned long m;
+{
+	int i;
+	unsigned long c;
+	c = 0L;
+	for (i = NLIMB - 1; i >= 0; i--) {
+		c = a[i] * m + c;
+		a[i] = c & 0xFFFFL;
+		c >>= 16;
+	}
+}
+
+// r = a * b, truncated; a, b < 2
+void bmul(r, a, b)
+big r;
+big a;
+big b;
+{
+	big t;
+	int i;
+	int k;
+	unsigned long v;
+	unsigned long p;
+	v = 0L;
+	for (k = NLIMB - 1; k >= 0; k--) {
+		// low halves of column k, high halves of column k + 1
+		for (i = 0; i <= k; i++) {
+			p = a[i] * b[k - i];
+			v += p & 0xFFFFL;
+		}
+		for (i = 0; i <= k + 1 && k + 1 < 2 * NLIMB - 1; i++) {
+			if (i >= NLIMB || k + 1 - i >= NLIMB) continue;
+			p = a[i] * b[k + 1 - i];
+			v += p >> 16;
+		}
+		t[k] = v & 0xFFFFL;
+		v >>= 16;
+	}
+	bcpy(r, t);
+}
+
+// a >= b
+int bge(a, b)
+big a;
+big b;
+{
+	int i;
+	for (i = 0; i < NLIMB; i++)
+		if (a[i] != b[i]) return a[i] > b[i];
+	return 1;
+}
+
+int iszero(a)
+big a;
+{
+	int i;
+	for (i = 0; i < NLIMB; i++) if (a[i] != 0L) return 0;
+	return 1;
+}
+
+// n bits (n <= 32) starting at weight 2^-p, -15 <= p
+unsigned long bbits(a, p, n)
+big a;
+int p;
+int n;
+{
+	unsigned long r;
+	int j;
+	r = 0L;
+	for (; n > 0; n--, p++) {
+		j = (p + 15) / 16;
+		r = (r << 1) | ((a[j] >> (16 * j - p)) & 1L);
+	}
+	return r & 0xFFFFFFFFL;
+}
+
+// atan(2^-k) = sum (-1)^n 2^-k(2n+1) / (2n+1), k >= 1
+void atnp2(r, k)
+big r;
+int k;
+{
+	big p;
+	big t;
+	unsigned long n;
+	bclr(r);
+	bpow2(p, k);
+	for (n = 0L; !iszero(p); n++) {
+		bcpy(t, p);
+		bdiv(t, 2L * n + 1L);
+		if (n & 1L) bsub(r, t); else badd(r, t);
+		bshr(p, 2 * k);
+	}
+}
+
+// atanh(2^-k) = sum 2^-k(2n+1) / (2n+1), k >= 1
+void athp2(r, k)
+big r;
+int k;
+{
+	big p;
+	big t;
+	unsigned long n;
+	bclr(r);
+	bpow2(p, k);
+	for (n = 0L; !iszero(p); n++) {
+		bcpy(t, p);
+		bdiv(t, 2L * n + 1L);
+		badd(r, t);
+		bshr(p, 2 * k);
+	}
+}
+
+// atan(1/m) = sum (-1)^n / ((2n+1) m^(2n+1)), m*m < 65536
+void atninv(r, m)
+big r;
+unsigned long m;
+{
+	big p;
+	big t;
+	unsigned long n;
+	bclr(r);
+	bpow2(p, 0);
+	bdiv(p, m);
+	for (n = 0L; !iszero(p); n++) {
+		bcpy(t, p);
+		bdiv(t, 2L * n + 1L);
+		if (n & 1L) bsub(r, t); else badd(r, t);
+		bdiv(p, m * m);
+	}
+}
+
+// s = sin(k/32), c = cos(k/32) by their series
+void sincs(s, c, k)
+big s;
+big c;
+int k;
+{
+	big p;
+	unsigned long n;
+	bclr(s);
+	bpow2(p, 5);
+	bmuls(p, (unsigned long)k);
+	for (n = 1L; !iszero(p); n += 2L) {
+		if (n & 2L) bsub(s, p); else badd(s, p);
+		bmuls(p, (unsigned long)(k * k));
+		bshr(p, 10);
+		bdiv(p, (n + 1L) * (n + 2L));
+	}
+	bclr(c);
+	bpow2(p, 0);
+	for (n = 0L; !iszero(p); n += 2L) {
+		if (n & 2L) bsub(c, p); else badd(c, p);
+		bmuls(p, (unsigned long)(k * k));
+		bshr(p, 10);
+		bdiv(p, (n + 1L) * (n + 2L));
+	}
+}
+
+// atan(k/16) by Euler's series: with y = x^2 / (1 + x^2),
+// atan x = sum a_n, a_0 = x / (1 + x^2),
+// a_n = a_(n-1) * y * 2n / (2n + 1)
+void atnk16(r, k)
+big r;
+int k;
+{
+	big p;
+	unsigned long n;
+	unsigned long d;
+	d = 256L + (unsigned long)(k * k);
+	bclr(r);
+	bpow2(p, 0);
+	bmuls(p, 16L * (unsigned long)k);
+	bdiv(p, d);
+	for (n = 1L; !iszero(p); n++) {
+		badd(r, p);
+		bmuls(p, (unsigned long)(k * k));
+		bdiv(p, d);
+		bmuls(p, 2L * n);
+		bdiv(p, 2L * n + 1L);
+	}
+}
+
+// atanh(p/q) = sum (p/q)^(2n+1) / (2n+1), p < q < 65536
+void athpq(r, p, q)
+big r;
+unsigned long p;
+unsigned long q;
+{
+	big t;
+	big u;
+	unsigned long n;
+	bclr(r);
+	bpow2(t, 0);
+	bmuls(t, p);
+	bdiv(t, q);
+	for (n = 0L; !iszero(t); n++) {
+		bcpy(u, t);
+		bdiv(u, 2L * n + 1L);
+		badd(r, u);
+		bmuls(t, p);
+		bmuls(t, p);
+		bdiv(t, q);
+		bdiv(t, q);
+	}
+}
+
+// next hyperbolic CORDIC shift after i, with k = 4, 13, 40, ...
+// the next one taken twice; returns i unchanged for the repeat
+int hynext(i, k)
+int i;
+int *k;
+{
+	if (i == *k) {
+		*k = 3 * *k + 1;
+		return i;
+	}
+	return i + 1;
+}
+
+// q = a / b by restoring division, 0 <= a < 2b
+void bquo(q, a, b)
+big q;
+big a;
+big b;
+{
+	big r;
+	int p;
+	int j;
+	bclr(q);
+	bcpy(r, a);
+	for (p = 0; p < 16 * (NLIMB - 1); p++) {
+		if (bge(r, b)) {
+			bsub(r, b);
+			j = (p + 15) / 16;
+			q[j] |= 1L << (16 * j - p);
+		}
+		bshl1(r);
+	}
+}
+
+// |a - b| < 2^-100
+int bnear(a, b)
+big a;
+big b;
+{
+	big d;
+	bcpy(d, a);
+	bsub(d, b);
+	if (d[0] & 0x8000L) {
+		bclr(d);
+		badd(d, b);
+		bsub(d, a);
+	}
+	return bbits(d, -15, 32) == 0L && bbits(d, 17, 32) == 0L
+		&& bbits(d, 49, 32) == 0L && bbits(d, 81, 20) == 0L;
+}
+
+// write a as Q2.62, rounded to nearest
+void putq2(a, cmt)
+big a;
+char *cmt;
+{
+	big t;
+	big h;
+	bcpy(t, a);
+	bpow2(h, 63);
+	badd(t, h);
+	fprintf(fo, "    .dc.l   $%08lX,$%08lX   ; %s\n",
+		bbits(t, -1, 32), bbits(t, 31, 32), cmt);
+}
+
+// write a (0 <= a < 1) as Q0.32, rounded to nearest
+void putq0(a, b, cmt)
+big a;
+big b;
+char *cmt;
+{
+	big t;
+	big h;
+	bpow2(h, 33);
+	bcpy(t, a);
+	badd(t, h);
+	fprintf(fo, "    .dc.l   $%08lX,", bbits(t, 1, 32));
+	bcpy(t, b);
+	badd(t, h);
+	fprintf(fo, "$%08lX   ; %s\n", bbits(t, 1, 32), cmt);
+}
+
+// write a (>= 0), negated if neg, as spx {sign, expo, man}, man
+// rounded to nearest
+void putspx(a, neg, cmt)
+big a;
+int neg;
+char *cmt;
+{
+	big t;
+	big h;
+	int p;
+	if (iszero(a)) {
+		fprintf(fo, "    .dc.w   0,-16384\n    .dc.l   $00000000             ; %s\n",
+			cmt);
+		return;
+	}
+	for (p = 0; bbits(a, p, 1) == 0L; p++) ;
+	bcpy(t, a);
+	bpow2(h, p + 32);
+	badd(t, h);
+	if (bbits(t, p - 1, 1) != 0L) p--;
+	fprintf(fo, "    .dc.w   %d,%d\n    .dc.l   $%08lX             ; %s\n",
+		neg ? -1 : 0, -p, bbits(t, p, 32), cmt);
+}
+
+int main()
+{
+	big a;
+	big b;
+	big c;
+	big pi4;
+	big ln2;
+	big il2;
+	big lg102;
+	big sn[NSCTB + 1];
+	big cs[NSCTB + 1];
+	big lgt[LG2J1 - LG2J0 + 1];
+	big hki;
+	char cmt[24];
+	unsigned long n;
+	int i;
+	int j;
+	int k;
+
+	// pi/4 = atan(1/2) + atan(1/3), checked against Machin
+	atnp2(pi4, 1);
+	atninv(a, 3L);
+	badd(pi4, a);
+	atninv(a, 5L);
+	bcpy(b, a);
+	badd(b, a);
+	badd(b, b);
+	atninv(a, 239L);
+	bsub(b, a);
+	if (!bnear(pi4, b)) {
+		printf("mktbl: pi/4 check failed\n");
+		return 1;
+	}
+	// atan(1/2) by shifts, checked against atan(1/3) + atan(1/7)
+	atnp2(a, 1);
+	atninv(b, 3L);
+	atninv(c, 7L);
+	badd(b, c);
+	if (!bnear(a, b)) {
+		printf("mktbl: atan(1/2) check failed\n");
+		return 1;
+	}
+	// sin(k/32)^2 + cos(k/32)^2 = 1
+	for (i = 1; i <= NSCTB; i++) {
+		sincs(sn[i], cs[i], i);
+		bmul(a, sn[i], sn[i]);
+		bmul(b, cs[i], cs[i]);
+		badd(a, b);
+		bpow2(b, 0);
+		if (!bnear(a, b)) {
+			printf("mktbl: sin/cos check failed at %d/32\n", i);
+			return 1;
+		}
+	}
+
+	// atan(16/16) = pi/4 and atan(8/16) = atan(1/2)
+	atnk16(a, 16);
+	atnk16(b, 8);
+	atnp2(c, 1);
+	if (!bnear(a, pi4) || !bnear(b, c)) {
+		printf("mktbl: attb check failed\n");
+		return 1;
+	}
+
+	// ln2 = 2 atanh(1/3), checked against ln(4/3) + ln(3/2)
+	athpq(ln2, 1L, 3L);
+	badd(ln2, ln2);
+	athpq(a, 1L, 7L);
+	athpq(b, 1L, 5L);
+	badd(a, b);
+	badd(a, a);
+	if (!bnear(ln2, a)) {
+		printf("mktbl: ln2 check failed\n");
+		return 1;
+	}
+	// log10(2) = (ln2 / 4) / (ln10 / 4), ln10 = 3 ln2 + 2 atanh(1/9);
+	// 1/ln2; each multiplied back
+	athpq(a, 1L, 9L);
+	badd(a, a);
+	badd(a, ln2);
+	badd(a, ln2);
+	badd(a, ln2);
+	bshr(a, 2);
+	bcpy(b, ln2);
+	bshr(b, 2);
+	bquo(lg102, b, a);
+	bmul(c, lg102, a);
+	if (!bnear(c, b)) {
+		printf("mktbl: log10(2) check failed\n");
+		return 1;
+	}
+	bpow2(a, 0);
+	bquo(il2, a, ln2);
+	bmul(b, il2, ln2);
+	if (!bnear(a, b)) {
+		printf("mktbl: 1/ln2 check failed\n");
+		return 1;
+	}
+	// |log2 c| = |ln(n/128)| / ln2, ln(n/128) = 2 atanh((n-128)/(n+128))
+	for (i = LG2J0; i <= LG2J1; i++) {
+		n = (4096L + i / 2) / i;
+		athpq(a, (n > 128L) ? n - 128L : 128L - n, n + 128L);
+		badd(a, a);
+		bquo(lgt[i - LG2J0], a, ln2);
+		bmul(b, lgt[i - LG2J0], ln2);
+		if (!bnear(a, b)) {
+			printf("mktbl: lg2tb check failed at %d/32\n", i);
+			return 1;
+		}
+	}
+
+	// 2 atanh(1/2) = ln 3 = ln2 + 2 atanh(1/5)
+	athp2(a, 1);
+	badd(a, a);
+	athpq(b, 1L, 5L);
+	badd(b, b);
+	badd(b, ln2);
+	if (!bnear(a, b)) {
+		printf("mktbl: atanh(1/2) check failed\n");
+		return 1;
+	}
+	// 1/K = sqrt(1 / prod (1 - 4^-i)) over NHYR steps, by Newton
+	bpow2(a, 0);
+	k = 4;
+	for (i = 1, j = 0; j < NHYR; i = hynext(i, &k), j++) {
+		bcpy(b, a);
+		bshr(b, 2 * i);
+		bsub(a, b);
+	}
+	bpow2(b, 0);
+	bquo(c, b, a);
+	bcpy(hki, c);
+	for (j = 0; j < 10; j++) {
+		bquo(a, c, hki);
+		badd(hki, a);
+		bshr(hki, 1);
+	}
+	bmul(a, hki, hki);
+	if (!bnear(a, c)) {
+		printf("mktbl: 1/K check failed\n");
+		return 1;
+	}
+
+	fo = fopen("spftbl.s", "w");
+	if (fo == NULL) {
+		printf("mktbl: cannot open spftbl.s\n");
+		return 1;
+	}
+	fprintf(fo, "*-----------------------------------------------------------\n");
+	fprintf(fo, "* Title      : spftbl.s\n");
+	fprintf(fo, "*              constant tables for the floating point\n");
+	fprintf(fo, "*              library, written by mktbl.c - do not edit\n");
+	fprintf(fo, "*\n");
+	fprintf(fo, "*   atntb  atan(2^-i), i = 0..%d, Q2.62 (hi, lo)\n", NATN - 1);
+	fprintf(fo, "*   q2pi2  pi/2, Q2.62\n");
+	fprintf(fo, "*   exptb  1/k!, k = 0..%d, spx (sign, expo, man)\n", NEXP - 1);
+	fprintf(fo, "*   lg2tb  c = round(4096/j)/128, -log2 c, j = %d..%d, spx\n", LG2J0, LG2J1);
+	fprintf(fo, "*   lg2pc  (-1)^(k+1) / (k ln2), k = 1..%d, spx\n", NLG2C);
+	fprintf(fo, "*   lg2cv  ln2, log10(2), spx\n");
+	fprintf(fo, "*   fopi   4/pi, %d bits from 2^0 down, after one zero long\n", 32 * NFOPI);
+	fprintf(fo, "*   sctb   sin(k/32), cos(k/32), k = 1..%d, Q0.32\n", NSCTB);
+	fprintf(fo, "*   attb   atan(k/16), k = 1..%d, Q2.62\n", NATTB);
+	fprintf(fo, "*   athtb  atanh(2^-i), i = 1..%d, 4 and 13 twice, Q2.62\n", NATH);
+	fprintf(fo, "*   q2hki  1/K, K = prod sqrt(1 - 4^-i), first %d steps\n", NHYR);
+	fprintf(fo, "*   Values are rounded to nearest from 256-bit sums; the\n");
+	fprintf(fo, "*   4/pi bits are exact (truncated).\n");
+	fprintf(fo, "*   The tables are read only and sit in the text section,\n");
+	fprintf(fo, "*   so the library may be put in ROM.\n");
+	fprintf(fo, "*-----------------------------------------------------------\n");
+	fprintf(fo, "* Copyright 2025 John J Lovrinic, MIT License (see LICENSE)\n");
+	fprintf(fo, "*-----------------------------------------------------------\n");
+	fprintf(fo, "    .globl      _atntb\n");
+	fprintf(fo, "    .globl      _q2pi2\n");
+	fprintf(fo, "    .globl      _exptb\n");
+	fprintf(fo, "    .globl      _lg2tb\n");
+	fprintf(fo, "    .globl      _lg2pc\n");
+	fprintf(fo, "    .globl      _lg2cv\n");
+	fprintf(fo, "    .globl      _fopi\n");
+	fprintf(fo, "    .globl      _sctb\n");
+	fprintf(fo, "    .globl      _attb\n");
+	fprintf(fo, "    .globl      _athtb\n");
+	fprintf(fo, "    .globl      _q2hki\n");
+	fprintf(fo, "\n    .text\n    .even\n_atntb:\n");
+	putq2(pi4, "atan(2^-0)");
+	for (i = 1; i < NATN; i++) {
+		atnp2(a, i);
+		sprintf(cmt, "atan(2^-%d)", i);
+		putq2(a, cmt);
+	}
+	fprintf(fo, "_q2pi2:\n");
+	bcpy(a, pi4);
+	badd(a, pi4);
+	putq2(a, "pi/2");
+	fprintf(fo, "_exptb:\n");
+	bpow2(a, 0);
+	for (i = 0; i < NEXP; i++) {
+		if (i > 1) bdiv(a, (unsigned long)i);
+		sprintf(cmt, "1/%d!", i);
+		putspx(a, 0, cmt);
+	}
+	fprintf(fo, "_lg2tb:\n");
+	for (i = LG2J0; i <= LG2J1; i++) {
+		n = (4096L + i / 2) / i;
+		bpow2(a, 7);
+		bmuls(a, n);
+		sprintf(cmt, "%ld/128", n);
+		putspx(a, 0, cmt);
+		sprintf(cmt, "-log2(%ld/128)", n);
+		putspx(lgt[i - LG2J0], n > 128L, cmt);
+	}
+	fprintf(fo, "_lg2pc:\n");
+	for (i = 1; i <= NLG2C; i++) {
+		bcpy(a, il2);
+		bdiv(a, (unsigned long)i);
+		sprintf(cmt, "%s1/(%d ln2)", (i & 1) ? "" : "-", i);
+		putspx(a, !(i & 1), cmt);
+	}
+	fprintf(fo, "_lg2cv:\n");
+	putspx(ln2, 0, "ln2");
+	putspx(lg102, 0, "log10(2)");
+	// 4/pi = 1 / (pi/4) by restoring division, one bit at a time
+	fprintf(fo, "_fopi:\n    .dc.l   $00000000\n");
+	bpow2(a, 0);
+	for (i = 0; i < NFOPI; i++) {
+		unsigned long w;
+		int k;
+		w = 0L;
+		for (k = 0; k < 32; k++) {
+			w <<= 1;
+			if (bge(a, pi4)) {
+				bsub(a, pi4);
+				w |= 1L;
+			}
+			bshl1(a);
+		}
+		fprintf(fo, "    .dc.l   $%08lX\n", w & 0xFFFFFFFFL);
+	}
+	fprintf(fo, "_sctb:\n");
+	for (i = 1; i <= NSCTB; i++) {
+		sprintf(cmt, "sin, cos %d/32", i);
+		putq0(sn[i], cs[i], cmt);
+	}
+	fprintf(fo, "_attb:\n");
+	for (i = 1; i <= NATTB; i++) {
+		atnk16(a, i);
+		sprintf(cmt, "atan(%d/16)", i);
+		putq2(a, cmt);
+	}
+	fprintf(fo, "_athtb:\n");
+	k = 4;
+	for (i = 1; i <= NATH; i = hynext(i, &k)) {
+		athp2(a, i);
+		sprintf(cmt, "atanh(2^-%d)", i);
+		putq2(a, cmt);
+	}
+	fprintf(fo, "_q2hki:\n");
+	putq2(hki, "1/K");
+	fclose(fo);
+	printf("mktbl: spftbl.s written\n");
+	return 0;
+}
@@ -2,17 +2,44 @@
 #include <stdio.h>
 #include <spflib.h>
 
-void    main()
-{
-spf     o1, o2, res;
+/* multest.c - spfmul spot checks (rounding, overflow, underflow, specials) */
 
 #define pi4p2   0x3f1de9e6
 #define pi4p4   0x3ec2d174
-#define pi4p6   0x3e7058e9
+#define pi4p6   0x3e7058e8
+
+#define NMUL    9
 
-        o1=pi4p2;
-        o2=pi4p4;
-        res=spfmul(o1,o2);
-        printf("done\n");
+spf     op1[NMUL];
+spf     op2[NMUL];
+spf     want[NMUL];
+
+void    mulset()
+{
+        op1[0]=pi4p2;           op2[0]=pi4p4;           want[0]=pi4p6;
+        op1[1]=0x3fa00000L;     op2[1]=spfpi;           want[1]=0x407b53d2L;    /* 1.25*pi */
+        op1[2]=0x3f800001L;     op2[2]=0x3f800001L;     want[2]=0x3f800002L;    /* round down */
+        op1[3]=0x3fffffffL;     op2[3]=0x3fffffffL;     want[3]=0x407ffffeL;    /* round up */
+        op1[4]=0xc0400000L;     op2[4]=0x40400000L;     want[4]=0xc1100000L;    /* -3*3 */
+        op1[5]=0x7f000000L;     op2[5]=spftwo;          want[5]=0x7f800000L;    /* overflow */
+        op1[6]=0x00800000L;     op2[6]=spfhlf;          want[6]=spfz;           /* underflow */
+        op1[7]=0x7f800000L;     op2[7]=spfz;            want[7]=spfNAN;         /* inf*0 */
+        op1[8]=spfone;          op2[8]=spfnz;           want[8]=spfz;           /* -0 */
 }
 
+void    main()
+{
+spf     res;
+long    i;
+long    bad;
+
+        mulset();
+        bad=0L;
+        for(i=0L;i<NMUL;i++) {
+                res=spfmul(op1[i],op2[i]);
+                printf("%08lX * %08lX = %08lX  %s\n",op1[i],op2[i],res,
+                        (res==want[i]) ? "ok" : "FAIL");
+                if(res!=want[i]) bad++;
+        }
+        printf("done, %ld failures\n",bad);
+}
@@ -0,0 +1,107 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* powbench.c - spfpow against the exp(y ln x) form it replaced         */
+/*   Prints both, with the spread between them in ulp, for integer,     */
+/*   half-integer and general exponents and for large results, where    */
+/*   the old form carried the error of ln x times y.  Then each path    */
+/*   runs NREP times against the old form; time the pairs between the   */
+/*   go/end lines.  The ulp column is -1 where the old form gave NaN.   */
+/*   Overflow and underflow must raise the same flags whether they      */
+/*   come out of the |w| >= 256 cut-off or the final rounding, and      */
+/*   zero to a negative power must raise SPFDZ as spfdiv does.          */
+
+#define NREP    100L
+#define NCASE   16
+#define NFLG    7
+
+long    cx[NCASE] = {
+        0x40400000L, 0x40400000L, 0xc0000000L, 0x3fc00000L,    /* 3 3 -2 1.5 */
+        0x40000000L, 0x41200000L, 0x3f000000L, 0x40490fdbL,    /* 2 10 .5 pi */
+        0x40490fdbL, 0x3f8ccccdL, 0x41200000L, 0x3f7ff000L,    /* pi 1.1 10 */
+        0x40000000L, 0x3f800800L, 0x4479c000L, 0xc1200000L     /* 2 999 -10 */
+};
+long    cy[NCASE] = {
+        0x40a00000L, 0xc0000000L, 0x40e00000L, 0x42800000L,    /* 5 -2 7 64 */
+        0x3f000000L, 0x40200000L, 0xc0200000L, 0x3f2aaaabL,    /* .5 2.5 -2.5 */
+        0x428c0000L, 0x435c0000L, 0x421a0000L, 0x46000000L,    /* 70 220 38.5 */
+        0x42fe0000L, 0x45800000L, 0x41300000L, 0x3fc00000L     /* 127 4096 11 */
+};
+
+/* x, y and the flags x^y must leave (SPFALL) */
+long    fx[NFLG] = {
+        0x40000000L, 0x40000000L, 0x40000000L,                 /* 2 2 2 */
+        0x40000000L, 0x7f800000L, 0x3f000000L,                 /* 2 inf .5 */
+        0x00000000L                                            /* 0 */
+};
+long    fy[NFLG] = {
+        0x44800000L, 0xc4800000L, 0x43010000L,                 /* 1024 -1024 129 */
+        0xc3200000L, 0x40000000L, 0x7f800000L,                 /* -160 2 inf */
+        0xbf800000L                                            /* -1 */
+};
+long    ff[NFLG] = {
+        SPFOVF|SPFINX, SPFUNF|SPFINX, SPFOVF|SPFINX,
+        SPFUNF|SPFINX, 0L, 0L,
+        SPFDZ
+};
+
+spf     oldpow(x, y)
+spf     x;
+spf     y;
+{
+        return spfexp(spfmul(spfln(x),y));
+}
+
+void    main()
+{
+spf     a;
+spf     b;
+spf     s;
+long    i;
+long    k;
+long    bad;
+
+        printf("    x        y      spfpow   old      ulp\n");
+        for(i=0L;i<(long)NCASE;i++) {
+                a=spfpow(cx[i],cy[i]);
+                b=oldpow(cx[i],cy[i]);
+                printf("%08lX %08lX  %08lX %08lX %6ld\n",
+                        cx[i],cy[i],a,b,((a^b)<0L) ? -1L : udist(a,b));
+        }
+
+        /* sticky flags */
+        bad=0L;
+        for(i=0L;i<(long)NFLG;i++) {
+                spfclr(SPFALL);
+                a=spfpow(fx[i],fy[i]);
+                if(spftst(SPFALL)!=ff[i]) {
+                        printf("%08lX %08lX flags %lX  FAIL\n",
+                                fx[i],fy[i],spftst(SPFALL));
+                        bad++;
+                }
+        }
+        spfclr(SPFALL);
+        printf("flags done, %ld failures\n",bad);
+
+        /* timing */
+        go("integer");
+        for(k=0L;k<NREP;k++) s=spfpow(cx[0],cy[0]);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldpow(cx[0],cy[0]);
+        end();
+        go("half");
+        for(k=0L;k<NREP;k++) s=spfpow(cx[5],cy[5]);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldpow(cx[5],cy[5]);
+        end();
+        go("general");
+        for(k=0L;k<NREP;k++) s=spfpow(cx[7],cy[7]);
+        end();
+        go("old");
+        for(k=0L;k<NREP;k++) s=oldpow(cx[7],cy[7]);
+        end();
+}
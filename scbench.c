@@ -0,0 +1,53 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* scbench.c - scpoly (spfscp.s) against cord8, the two sin/cos engines */
+/*   Prints both over a sweep of [0, pi/4] with the spread between them */
+/*   in ulp, then runs each NREP times; time the pairs between the      */
+/*   go/end lines.  Error and cycle tables are in the spfscp.s header.  */
+
+#define NANG    32L
+#define NREP    200L
+#define C_PI4   0x3f490fdbL     /* pi/4 */
+
+void    scpoly();
+void    cord8();
+
+void    main()
+{
+spf     a;
+spf     da;
+spf     s;
+spf     c;
+spf     sc;
+spf     cc;
+long    i;
+long    k;
+
+        printf("  angle    scpoly sin/cos      cord8 sin/cos     ulp\n");
+        da=spfdiv(C_PI4,spfltf(NANG));
+        a=da;
+        for(i=1L;i<=NANG;i++) {
+                scpoly(a,&s,&c);
+                cord8(a,&sc,&cc);
+                printf("%08lX  %08lX %08lX  %08lX %08lX  %ld %ld\n",
+                        a,s,c,sc,cc,udist(s,sc),udist(c,cc));
+                a=spfadd(a,da);
+        }
+        a=0x3a83126fL;                  /* 0.001: cord8 keeps Q2.30 only */
+        scpoly(a,&s,&c);
+        cord8(a,&sc,&cc);
+        printf("%08lX  %08lX %08lX  %08lX %08lX  %ld %ld\n",
+                a,s,c,sc,cc,udist(s,sc),udist(c,cc));
+
+        /* timing */
+        a=0x3f060a92L;                  /* pi/6 */
+        go("scpoly");
+        for(k=0L;k<NREP;k++) scpoly(a,&s,&c);
+        end();
+        go("cord8");
+        for(k=0L;k<NREP;k++) cord8(a,&s,&c);
+        end();
+}
@@ -0,0 +1,263 @@
+*-----------------------------------------------------------
+* Title      : spfadd.s
+* Written by : J. Lovrinic
+* Date       : 20261017
+*              68000 versions of the spfcore.c core ops:
+*              spfadd, spfsub, spfcmp, spfneg, spfabs
+*
+*   Results are bit-identical to the C versions in spfcore.c,
+*   which stay as the portable reference (build them instead
+*   by commenting out SPFASM in spfcore.c).  The dominant
+*   operand is picked with one integer compare of the
+*   magnitudes, and cancellation after a subtract is
+*   normalized with a leading-zero table instead of a
+*   bit-at-a-time loop.  spfcmp, spfneg and spfabs need no
+*   saved registers; spfadd saves D2-D4.  aentry and sentry
+*   are the register entries (x in D0, y in D1) used by
+*   spfsub and the spfvec.s loops.
+*
+*   Cycle counts (68000, no wait states, JSR not included):
+*     spfadd  aligned add / subtract        562-682
+*             cancellation (table path)     712-754
+*     spfsub  aligned                       702-862
+*     spfcmp                                94-98
+*     spfneg                                42-82
+*     spfabs                                46
+*-----------------------------------------------------------
+**********************************************************/
+* Copyright 2025 John J Lovrinic                         */
+* Permission is hereby granted, free of charge,          */     
+* to any person obtaining a copy of this software        */
+* and associated documentation files (the “Software”),   */
+* to deal in the Software without restriction,           */
+* including without limitation the rights to use,        */
+* copy, modify, merge, publish, distribute, sublicense,  */
+* and/or sell copies of the Software, and to permit      */
+* persons to whom the Software is furnished to do so,    */
+* subject to the following conditions:                   */
+*                                                        */
+* The above copyright notice and this permission notice  */
+* shall be included in all copies or substantial         */
+* portions of the Software.                              */
+*                                                        */
+* THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY     */
+* OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT     */
+* LIMITED TO THE WARRANTIES OF MERCHANTABILITY,          */
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  */
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS     */
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,   */
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,   */
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE         */
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+**********************************************************/
+    .globl      _spfadd
+    .globl      _spfsub
+    .globl      _spfcmp
+    .globl      _spfneg
+    .globl      _spfabs
+    .globl      aentry
+    .globl      sentry
+
+*-----------------------------------------------------------
+* spfadd(x, y)
+*-----------------------------------------------------------
+_spfadd:
+    MOVE.L  4(A7),D0        ; x
+    MOVE.L  8(A7),D1        ; y
+aentry:
+    TST.L   D1
+    BEQ     aretx           ; y == +0: return x
+    TST.L   D0
+    BEQ     arety           ; x == +0: return y
+    CMP.L   #$7FC00000,D0
+    BEQ     aretx           ; x is NaN
+    CMP.L   #$7FC00000,D1
+    BEQ     arety           ; y is NaN
+    MOVEM.L D2-D4,-(A7)
+
+* dominant operand: compare magnitudes (sign shifted out), ties keep x
+    MOVE.L  D0,D2
+    ADD.L   D2,D2
+    MOVE.L  D1,D3
+    ADD.L   D3,D3
+    CMP.L   D3,D2
+    BCC     aorder
+    EXG     D0,D1
+    EXG     D2,D3
+aorder:
+    EOR.L   D0,D1           ; D1 bit 31 set: signs differ
+
+* exponent fields: a into D4.w, a - b into D1.w (bit 31 of D1 kept)
+    MOVE.L  D2,D4
+    SWAP    D4
+    LSR.W   #8,D4
+    SWAP    D3
+    MOVE.W  D3,D1
+    SWAP    D3
+    LSR.W   #8,D1
+    NEG.W   D1
+    ADD.W   D4,D1
+    CMP.W   #24,D1
+    BGE     areta           ; b does not reach a's mantissa
+
+* mantissas with hidden bit and one rounding bit, align b
+    AND.L   #$00FFFFFF,D2
+    BSET    #24,D2
+    AND.L   #$00FFFFFF,D3
+    BSET    #24,D3
+    LSR.L   D1,D3
+    TST.L   D1
+    BMI     asub
+
+* same signs: add, at most one bit of carry
+    ADD.L   D3,D2
+    CMP.L   #$02000000,D2
+    BCS     around
+    LSR.L   #1,D2
+    ADDQ.W  #1,D4
+    BRA     around
+
+* signs differ: subtract and normalize up to bit 24
+asub:
+    SUB.L   D3,D2
+    BEQ     azero
+    CMP.L   #$01000000,D2
+    BCC     around
+    MOVEQ   #0,D3           ; D3 = byte shift
+    CMP.L   #$00010000,D2
+    BCC     anorm
+    MOVEQ   #8,D3
+    CMP.L   #$00000100,D2
+    BCC     anorm
+    MOVEQ   #16,D3
+anorm:
+    LSL.L   D3,D2           ; leading nonzero byte now in bits 16-23
+    MOVE.L  D2,D1
+    SWAP    D1
+    LEA     aclz,A0
+    MOVE.B  0(A0,D1.W),D1   ; bits left to reach bit 24
+    LSL.L   D1,D2
+    ADD.W   D1,D3
+    SUB.W   D3,D4
+
+* round (x & 3 == 1 rounds up, as the C version) and assemble
+around:
+    MOVEQ   #3,D1
+    AND.B   D2,D1
+    SUBQ.B  #1,D1
+    BNE     apack
+    ADDQ.L  #1,D2
+apack:
+    LSR.L   #1,D2
+    AND.L   #$007FFFFF,D2
+    LSL.W   #7,D4
+    SWAP    D4
+    CLR.W   D4
+    OR.L    D4,D2
+    AND.L   #$80000000,D0
+    OR.L    D2,D0
+    MOVEM.L (A7)+,D2-D4
+    RTS
+azero:
+    MOVEQ   #0,D0
+areta:
+    MOVEM.L (A7)+,D2-D4
+    RTS
+arety:
+    MOVE.L  D1,D0
+aretx:
+    RTS
+
+*-----------------------------------------------------------
+* spfsub(a, b) = spfadd(a, spfneg(b)), -0 result becomes +0
+*-----------------------------------------------------------
+_spfsub:
+    MOVE.L  4(A7),D0
+    MOVE.L  8(A7),D1
+sentry:
+    CMP.L   #$7FC00000,D0
+    BEQ     sfin            ; a is NaN
+    CMP.L   #$7FC00000,D1
+    BEQ     sretb           ; b is NaN
+    TST.L   D1
+    BEQ     sadd            ; spfneg(+0) is +0
+    BCHG    #31,D1
+sadd:
+    BSR     aentry
+    CMP.L   #$80000000,D0
+    BNE     sfin
+    MOVEQ   #0,D0
+sfin:
+    RTS
+sretb:
+    MOVE.L  D1,D0
+    RTS
+
+*-----------------------------------------------------------
+* spfcmp(a, b) - returns -1, 0, 1
+*   Ordered as signed integers except when both are
+*   negative, where the order flips; -0 < +0 as in the C.
+*-----------------------------------------------------------
+_spfcmp:
+    MOVE.L  4(A7),D0
+    MOVE.L  8(A7),D1
+    CMP.L   D1,D0
+    BEQ     ceq
+    BLT     clt
+    TST.L   D0              ; a > b as integers
+    BMI     cm1
+cp1:
+    MOVEQ   #1,D0
+    RTS
+clt:
+    TST.L   D1              ; a < b as integers
+    BMI     cp1
+cm1:
+    MOVEQ   #-1,D0
+    RTS
+ceq:
+    MOVEQ   #0,D0
+    RTS
+
+*-----------------------------------------------------------
+* spfneg(x) - NaN and +0 pass through unchanged
+*-----------------------------------------------------------
+_spfneg:
+    MOVE.L  4(A7),D0
+    BEQ     nfin
+    CMP.L   #$7FC00000,D0
+    BEQ     nfin
+    BCHG    #31,D0
+nfin:
+    RTS
+
+*-----------------------------------------------------------
+* spfabs(x) - spfNAN has a clear sign bit already
+*-----------------------------------------------------------
+_spfabs:
+    MOVE.L  4(A7),D0
+    BCLR    #31,D0
+    RTS
+
+*-----------------------------------------------------------
+* aclz[b] - left shifts that move the top set bit of byte b
+*   (held in bits 16-23) up to bit 24
+*-----------------------------------------------------------
+aclz:
+    .dc.b   0,8,7,7,6,6,6,6,5,5,5,5,5,5,5,5
+    .dc.b   4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4
+    .dc.b   3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3
+    .dc.b   3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3
+    .dc.b   2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2
+    .dc.b   2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2
+    .dc.b   2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2
+    .dc.b   2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2
+    .dc.b   1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    .dc.b   1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    .dc.b   1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    .dc.b   1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    .dc.b   1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    .dc.b   1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    .dc.b   1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    .dc.b   1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1
+    .even
@@ -0,0 +1,28 @@
+#ifndef SPFBCH_H
+#define SPFBCH_H
+
+/* spfbch.h - helpers shared by the bench programs                      */
+/*   go and end mark each timed run on the console; time the pairs      */
+/*   between them.  udist is the spread between two results in ulp.    */
+/*   Include after spflib.h.                                            */
+
+/* distance in ulp between two spf values of one sign */
+long    udist(a, b)
+spf     a;
+spf     b;
+{
+        return (a>b) ? a-b : b-a;
+}
+
+void    go(lbl)
+char    *lbl;
+{
+        printf("%-8s go ... ", lbl);
+}
+
+void    end()
+{
+        printf("end\n");
+}
+
+#endif
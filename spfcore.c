@@ -28,6 +28,12 @@
 #include <stdio.h>
 #include "spflib.h"
 
+// SPFASM: spfcmp, spfneg, spfabs, spfadd and spfsub come from spfadd.s,
+// spfdiv and spfrcp from spfdiv.s.  Comment it out (and drop spfadd.o
+// and spfdiv.o from cspf.sub) to build the portable C versions below
+// instead; the results are bit-identical.
+#define SPFASM 1
+
 // zero test
 spf spfzt(val)
 spf val;
@@ -37,6 +43,7 @@ spf val;
 	else return false;
 }
 
+#ifndef SPFASM
 // spfcmp - compare 2 floating point numbers
 long spfcmp(a, b)
 spf a;
@@ -60,13 +67,18 @@ spf b;
 	}
 	return work;
 }
+#endif
 
-// spfdiv - floating point division
+#ifndef SPFASM
+// spfdiv - floating point division, rounded to nearest even
+// x/0, 0/0, inf/inf and NaN operands give NaN; overflow gives
+// a signed infinity and underflow gives +0, as in spfmul.
+// Raises SPFDZ, SPFINV, SPFOVF, SPFUNF and SPFINX as spfdiv.s does.
 spf spfdiv(dividend, divisor)
 spf dividend;
 spf divisor;
 {
-	long divmant;	// dividend mantissa
+	long divmant;	// dividend mantissa, then the remainder
 	long dismant;	// divisor mantissa
 	long divexp;	// dividend exp
 	long disexp;	// divisor exp
@@ -74,24 +86,50 @@ spf divisor;
 	long qexp;	// quotient exponent
 	long j;	// loop counter
 	long sign;	// sign variable
-	long guard, round, sticky;
-	sign = (dividend & 0x80000000L) ^ (divisor & 0x80000000L);
+	sign = (dividend ^ divisor) & 0x80000000L;
+	divexp = (dividend >> 23L) & 0xffL;
+	disexp = (divisor >> 23L) & 0xffL;
 	// range check
-	if (spfzt(divisor)) {
-		quotient = spfNAN;
-		printf("Bad value dividor.\n");
-		return quotient;
+	if (disexp == 0L) {
+		if (divexp == 0L) {
+			spfrse(SPFINV);
+		} else if (divexp != 0xffL || (dividend & 0x007fffffL) == 0L) {
+			spfrse(SPFDZ);
+		}
+		return spfNAN;
 	}
-	if (spfzt(dividend)) {
-		quotient = 0L;
-		return quotient;
+	if (disexp == 0xffL) {
+		if ((divisor & 0x007fffffL) != 0L) return spfNAN;
+		if (divexp != 0xffL) return spfz;
+		if ((dividend & 0x007fffffL) == 0L) spfrse(SPFINV);
+		return spfNAN;
+	}
+	if (divexp == 0L) return spfz;
+	if (divexp == 0xffL) {
+		if ((dividend & 0x007fffffL) != 0L) return spfNAN;
+		return (sign | 0x7f800000L);
 	}
-	quotient = 0L;
 	divmant = 0x007fffffL & dividend;
 	divmant |= 0x00800000L;
 	dismant = 0x007fffffL & divisor;
 	dismant |= 0x00800000L;
-	for (j = 1L; j <= 27L; j++) {
+	// determine quotient exp, with the dividend mantissa >= divisor's
+	qexp = divexp - disexp + 127L;
+	if (divmant < dismant) {
+		divmant <<= 1L;
+		qexp -= 1L;
+	}
+	if (qexp < 1L) {
+		spfrse(SPFUNF | SPFINX);
+		return spfz;
+	}
+	if (qexp > 254L) {
+		spfrse(SPFOVF | SPFINX);
+		return (sign | 0x7f800000L);
+	}
+	// 25 quotient bits: 24 for the mantissa and a round bit
+	quotient = 0L;
+	for (j = 1L; j <= 25L; j++) {
 		quotient <<= 1L;
 		if (divmant >= dismant) {
 			quotient += 1L;
@@ -99,48 +137,35 @@ spf divisor;
 		}
 		divmant <<= 1L;
 	}
-	// address rounding
-	guard = quotient & 0x00000004L >> 2L;
-	round = (quotient & 0x00000002L) >> 1L;
-	sticky = (quotient & 0x00000001L);
-	if ((divmant & 0x80000000L) != 0L) {
-		round = 1L;
-	} else {
-		round = 0L;
-	}
-	if (guard != 0L) {
-		if ((round != 0L) || (sticky != 0L) || ((quotient & 0x00000008L) != 0L)) {
-			quotient += 0x00000008L;
+	// round to nearest even, any remainder is the sticky bit
+	if ((quotient & 1L) != 0L || divmant != 0L) {
+		spfrse(SPFINX);
+		if ((quotient & 1L) != 0L) {
+			if (divmant != 0L || (quotient & 2L) != 0L) {
+				quotient += 2L;
+			}
 		}
 	}
-	quotient >>= 3L;
-	// determine quotient exp
-	divexp = (0x7f800000L & dividend) >> 23L;
-	divexp -= 127L;
-	disexp = (0x7f800000L & divisor) >> 23L;
-	disexp -= 127L;
-	qexp = divexp - disexp;
+	quotient >>= 1L;
 	// Handle overflow due to rounding
 	if (quotient & 0x01000000L) {
 		quotient >>= 1L;
 		qexp += 1L;
 	}
-	// normalize the quotient and exponent
-	while (quotient < 0x00800000L) {
-		quotient <<= 1L;
-		qexp -= 1L;
-	}
-	// convert exp format
-	qexp = qexp + 127L;
-	// assemble complete quotient
-	// format quotient - remove leading 1
+	// format quotient - remove leading 1, add exp and sign
 	quotient &= 0x007fffffL;
-	// format and incorporate exp
 	quotient |= (qexp << 23L);
 	quotient |= sign;
 	return quotient;
 }
 
+// spfrcp - reciprocal, 1/x
+spf spfrcp(x)
+spf x;
+{
+	return spfdiv(spfone, x);
+}
+
 // floating point negation function
 spf spfneg(x)
 spf x;
@@ -250,6 +275,7 @@ spf b;
 	if (work == 0x80000000L) work = spfz;
 	return work;
 }
+#endif
 
 // spfmod - floating point mod function
 spf spfmod(a, b)
@@ -0,0 +1,1195 @@
+*-----------------------------------------------------------
+* Title      : spfcrd.s
+* Written by : J. Lovrinic
+* Date       : 20261017
+*              CORDIC kernels: q2rot, q1rot, q1vec, q1vecd,
+*              q2asn, q2hyp and q2hvc
+*
+*   Each routine is described above it.  The C loops kept in
+*   spft1.c behind CRDASM give the same bits.
+*-----------------------------------------------------------
+**********************************************************/
+* Copyright 2025 John J Lovrinic                         */
+* Permission is hereby granted, free of charge,          */     
+* to any person obtaining a copy of this software        */
+* and associated documentation files (the “Software”),   */
+* to deal in the Software without restriction,           */
+* including without limitation the rights to use,        */
+* copy, modify, merge, publish, distribute, sublicense,  */
+* and/or sell copies of the Software, and to permit      */
+* persons to whom the Software is furnished to do so,    */
+* subject to the following conditions:                   */
+*                                                        */
+* The above copyright notice and this permission notice  */
+* shall be included in all copies or substantial         */
+* portions of the Software.                              */
+*                                                        */
+* THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY     */
+* OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT     */
+* LIMITED TO THE WARRANTIES OF MERCHANTABILITY,          */
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  */
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS     */
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,   */
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,   */
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE         */
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+**********************************************************/
+    .globl      _q2rot
+    .globl      _q1rot
+    .globl      _q1vec
+    .globl      _q1vecd
+    .globl      _q2asn
+    .globl      _q2hyp
+    .globl      _q2hvc
+    .globl      _atntb
+    .globl      _athtb
+
+* q2rot(&x, &y, &z, n): n (at most 32) rotation-mode steps on
+* Q2.62 x, y and z for cord8 (spft1.c):
+*   z >= 0:  x -= y >> i,  y += x >> i,  z -= atntb[i]
+*   z <  0:  x += y >> i,  y -= x >> i,  z += atntb[i]
+* x and y stay in D0:D1 and D2:D3 and one temporary pair
+* carries both shifted terms: after x is updated, old x is
+* x_new -/+ (y >> i).  The 64-bit shift by i is LSR, ASR and
+* ROR by i and a mask of the top i bits (crdmsk); from i = 16
+* on, a SWAP and MOVE.W step does the first 16 bits.  z lives
+* in A4:A5, with the carry between the halves found by CMPA.
+_q2rot:
+    MOVEM.L D2-D7/A3-A5,-(A7)
+    MOVE.L  40(A7),A0
+    MOVEM.L (A0),D0-D1      ; x
+    MOVE.L  44(A7),A0
+    MOVEM.L (A0),D2-D3      ; y
+    MOVE.L  48(A7),A0
+    MOVEM.L (A0),A4-A5      ; z
+    MOVE.L  52(A7),A3       ; n
+    LEA     _atntb,A0
+    LEA     crdmsk,A1
+    MOVEQ   #0,D7           ; i
+
+* steps 0..15: shift by i
+cralp:
+    CMP.L   A3,D7
+    BGE     crdout
+    CMP.W   #16,D7
+    BEQ     crdhi
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    LSR.L   D7,D5           ; T >>= k
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low k bits of the high long
+    OR.L    D6,D5
+    MOVE.L  A4,D6
+    BMI     crang
+* z >= 0: x -= y >> i, y += x >> i, z -= atan(2^-i)
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= k
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low k bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    CMPA.L  4(A0),A5        ; z -= atntb[i], borrow by hand
+    BCC     cranb
+    SUBQ.L  #1,A4
+cranb:
+    SUBA.L  4(A0),A5
+    SUBA.L  (A0),A4
+    BRA     cranx
+* z < 0: x += y >> i, y -= x >> i, z += atan(2^-i)
+crang:
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= k
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low k bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    ADDA.L  4(A0),A5        ; z += atntb[i], carry by hand
+    CMPA.L  4(A0),A5
+    BCC     cranc
+    ADDQ.L  #1,A4
+cranc:
+    ADDA.L  (A0),A4
+cranx:
+    ADDQ.L  #8,A0
+    ADDQ.L  #4,A1
+    ADDQ.W  #1,D7
+    BRA     cralp
+
+* steps 16..n-1: 16 bits by word moves, then by i - 16
+crdhi:
+    SUBA.W  #16,A3
+    MOVEQ   #0,D7           ; i - 16
+    LEA     crdmsk,A1
+crblp:
+    CMP.L   A3,D7
+    BGE     crdout
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= k
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low k bits of the high long
+    OR.L    D6,D5
+    MOVE.L  A4,D6
+    BMI     crbng
+* z >= 0: x -= y >> i, y += x >> i, z -= atan(2^-i)
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= k
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low k bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    CMPA.L  4(A0),A5        ; z -= atntb[i], borrow by hand
+    BCC     crbnb
+    SUBQ.L  #1,A4
+crbnb:
+    SUBA.L  4(A0),A5
+    SUBA.L  (A0),A4
+    BRA     crbnx
+* z < 0: x += y >> i, y -= x >> i, z += atan(2^-i)
+crbng:
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= k
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low k bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    ADDA.L  4(A0),A5        ; z += atntb[i], carry by hand
+    CMPA.L  4(A0),A5
+    BCC     crbnc
+    ADDQ.L  #1,A4
+crbnc:
+    ADDA.L  (A0),A4
+crbnx:
+    ADDQ.L  #8,A0
+    ADDQ.L  #4,A1
+    ADDQ.W  #1,D7
+    BRA     crblp
+
+crdout:
+    MOVE.L  40(A7),A0
+    MOVEM.L D0-D1,(A0)
+    MOVE.L  44(A7),A0
+    MOVEM.L D2-D3,(A0)
+    MOVE.L  48(A7),A0
+    MOVEM.L A4-A5,(A0)
+    MOVEM.L (A7)+,D2-D7/A3-A5
+    RTS
+
+* q1rot(&x, &y, &z, n): the same rotation steps in Q2.30, one
+* register each, with the high long of atntb as the angle; the
+* short tiers of spfsct
+_q1rot:
+    MOVEM.L D2-D4,-(A7)
+    MOVEM.L 16(A7),A0-A1
+    MOVE.L  (A0),D0         ; x
+    MOVE.L  (A1),D1         ; y
+    MOVE.L  24(A7),A0
+    MOVE.L  (A0),D2         ; z
+    LEA     _atntb,A0       ; high longs: atan(2^-i) in Q2.30
+    MOVEQ   #0,D4           ; i
+    BRA     q1rtst
+q1rlp:
+    MOVE.L  D1,D3
+    ASR.L   D4,D3           ; y >> i
+    TST.L   D2
+    BMI     q1rng
+    SUB.L   D3,D0
+    ADD.L   D0,D3           ; old x
+    ASR.L   D4,D3
+    ADD.L   D3,D1
+    SUB.L   (A0),D2
+    BRA     q1rnx
+q1rng:
+    ADD.L   D3,D0
+    NEG.L   D3
+    ADD.L   D0,D3           ; old x
+    ASR.L   D4,D3
+    SUB.L   D3,D1
+    ADD.L   (A0),D2
+q1rnx:
+    ADDQ.L  #8,A0
+    ADDQ.W  #1,D4
+q1rtst:
+    CMP.W   30(A7),D4
+    BLT     q1rlp
+q1out:
+    MOVEM.L 16(A7),A0-A1
+    MOVE.L  D0,(A0)
+    MOVE.L  D1,(A1)
+    MOVE.L  24(A7),A0
+    MOVE.L  D2,(A0)
+    MOVEM.L (A7)+,D2-D4
+    RTS
+
+* q1vec(&x, &y, &z, n): vectoring steps in Q2.30 (spfatt),
+* driving y to 0 and adding the angles turned into z
+_q1vec:
+    MOVEM.L D2-D4,-(A7)
+    MOVEM.L 16(A7),A0-A1
+    MOVE.L  (A0),D0         ; x
+    MOVE.L  (A1),D1         ; y
+    MOVE.L  24(A7),A0
+    MOVE.L  (A0),D2         ; z
+    LEA     _atntb,A0
+    MOVEQ   #0,D4           ; i
+    BRA     q1vtst
+q1vlp:
+    MOVE.L  D1,D3
+    ASR.L   D4,D3           ; y >> i
+    TST.L   D1
+    BLE     q1vng
+    ADD.L   D3,D0
+    NEG.L   D3
+    ADD.L   D0,D3           ; old x
+    ASR.L   D4,D3
+    SUB.L   D3,D1
+    ADD.L   (A0),D2
+    BRA     q1vnx
+q1vng:
+    SUB.L   D3,D0
+    ADD.L   D0,D3           ; old x
+    ASR.L   D4,D3
+    ADD.L   D3,D1
+    SUB.L   (A0),D2
+q1vnx:
+    ADDQ.L  #8,A0
+    ADDQ.W  #1,D4
+q1vtst:
+    CMP.W   30(A7),D4
+    BLT     q1vlp
+    BRA     q1out
+
+* q1vecd(&x, &y, &z, n): the q1vec steps with z a Q2.62 q2d
+* (spfatn, spfpol), the full atntb entries summed with ADDX
+_q1vecd:
+    MOVEM.L D2-D6,-(A7)
+    MOVEM.L 24(A7),A0-A1
+    MOVE.L  (A0),D0         ; x
+    MOVE.L  (A1),D1         ; y
+    MOVE.L  32(A7),A0
+    MOVE.L  (A0)+,D2        ; z high
+    MOVE.L  (A0),D5         ; z low
+    LEA     _atntb,A0
+    MOVEQ   #0,D4           ; i
+    BRA     q1dtst
+q1dlp:
+    MOVE.L  D1,D3
+    ASR.L   D4,D3           ; y >> i
+    TST.L   D1
+    BLE     q1dng
+    ADD.L   D3,D0
+    NEG.L   D3
+    ADD.L   D0,D3           ; old x
+    ASR.L   D4,D3
+    SUB.L   D3,D1
+    MOVE.L  (A0),D6
+    ADD.L   4(A0),D5
+    ADDX.L  D6,D2
+    BRA     q1dnx
+q1dng:
+    SUB.L   D3,D0
+    ADD.L   D0,D3           ; old x
+    ASR.L   D4,D3
+    ADD.L   D3,D1
+    MOVE.L  (A0),D6
+    SUB.L   4(A0),D5
+    SUBX.L  D6,D2
+q1dnx:
+    ADDQ.L  #8,A0
+    ADDQ.W  #1,D4
+q1dtst:
+    CMP.W   38(A7),D4
+    BLT     q1dlp
+    MOVEM.L 24(A7),A0-A1
+    MOVE.L  D0,(A0)
+    MOVE.L  D1,(A1)
+    MOVE.L  32(A7),A0
+    MOVE.L  D2,(A0)+
+    MOVE.L  D5,(A0)
+    MOVEM.L (A7)+,D2-D6
+    RTS
+
+* q2asn(&x, &y, &z, &t, n): n (at most 48) double-iteration
+* arcsine steps on Q2.62 x, y, z and t (spfasn, spfacs):
+*   up = (y <= t) and (x >= 0)
+*   up:   twice  x -= y >> i, y += x >> i;  z += atntb[i]
+*   down: twice  x += y >> i, y -= x >> i;  z -= atntb[i]
+*   t += t >> 2i
+* x and y stay in D0:D1 and D2:D3 and t in A4:A5; z is added
+* to in memory.  The turns are the q2rot step, two per call of
+* asau/asad (i < 16), asbu/asbd (16 <= i < 32, D7 = i - 16,
+* SWAP first) or ascu/ascd (i >= 32, D7 = i - 32: only the
+* high longs reach the low ones).  t >> 2i is t >> i twice;
+* from i = 32 on t no longer moves and atan(2^-i) is 2^-i.
+_q2asn:
+    MOVEM.L D2-D7/A2-A5,-(A7)
+    MOVE.L  44(A7),A0
+    MOVEM.L (A0),D0-D1      ; x
+    MOVE.L  48(A7),A0
+    MOVEM.L (A0),D2-D3      ; y
+    MOVE.L  56(A7),A0
+    MOVEM.L (A0),A4-A5      ; t
+    MOVE.L  52(A7),A3       ; &z
+    MOVE.W  62(A7),A2       ; n
+    LEA     _atntb,A0
+    LEA     crdmsk,A1
+    MOVEQ   #0,D7           ; i
+
+* steps 0..15
+aalp:
+    CMP.W   A2,D7
+    BGE     asout
+    CMP.W   #16,D7
+    BEQ     asbi
+    TST.L   D0              ; past pi/2: down
+    BMI     aadn
+    CMP.L   A4,D2           ; y <= t: up
+    BLT     aaup
+    BGT     aadn
+    CMP.L   A5,D3
+    BLS     aaup
+aadn:
+    BSR     asad
+    MOVE.L  4(A0),D6        ; z -= atntb[i]
+    SUB.L   D6,4(A3)
+    MOVE.L  (A0),D6
+    MOVE.L  (A3),D4
+    SUBX.L  D6,D4
+    MOVE.L  D4,(A3)
+    BRA     aatu
+aaup:
+    BSR     asau
+    MOVE.L  4(A0),D6        ; z += atntb[i]
+    ADD.L   D6,4(A3)
+    MOVE.L  (A0),D6
+    MOVE.L  (A3),D4
+    ADDX.L  D6,D4
+    MOVE.L  D4,(A3)
+aatu:
+    MOVE.L  A4,D4
+    MOVE.L  A5,D5           ; T = t
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    ADDA.L  D5,A5           ; t += T, carry by hand
+    CMPA.L  D5,A5
+    BCC     aatc
+    ADDQ.L  #1,A4
+aatc:
+    ADDA.L  D4,A4
+    ADDQ.L  #8,A0
+    ADDQ.L  #4,A1
+    ADDQ.W  #1,D7
+    BRA     aalp
+
+* steps 16..31
+asbi:
+    SUBA.W  #16,A2
+    MOVEQ   #0,D7           ; i - 16
+    LEA     crdmsk,A1
+ablp:
+    CMP.W   A2,D7
+    BGE     asout
+    CMP.W   #16,D7
+    BEQ     asci
+    TST.L   D0              ; past pi/2: down
+    BMI     abdn
+    CMP.L   A4,D2           ; y <= t: up
+    BLT     abup
+    BGT     abdn
+    CMP.L   A5,D3
+    BLS     abup
+abdn:
+    BSR     asbd
+    MOVE.L  4(A0),D6        ; z -= atntb[i]
+    SUB.L   D6,4(A3)
+    MOVE.L  (A0),D6
+    MOVE.L  (A3),D4
+    SUBX.L  D6,D4
+    MOVE.L  D4,(A3)
+    BRA     abtu
+abup:
+    BSR     asbu
+    MOVE.L  4(A0),D6        ; z += atntb[i]
+    ADD.L   D6,4(A3)
+    MOVE.L  (A0),D6
+    MOVE.L  (A3),D4
+    ADDX.L  D6,D4
+    MOVE.L  D4,(A3)
+abtu:
+    MOVE.L  A4,D5           ; T = t >> 32
+    MOVE.L  D5,D4
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    ASR.L   D7,D5           ; T >>= 2 (i - 16)
+    ASR.L   D7,D5
+    ADDA.L  D5,A5           ; t += T, carry by hand
+    CMPA.L  D5,A5
+    BCC     abtc
+    ADDQ.L  #1,A4
+abtc:
+    ADDA.L  D4,A4
+    ADDQ.L  #8,A0
+    ADDQ.L  #4,A1
+    ADDQ.W  #1,D7
+    BRA     ablp
+
+* steps 32..n-1
+asci:
+    SUBA.W  #16,A2
+    MOVEQ   #0,D7           ; i - 32
+aclp:
+    CMP.W   A2,D7
+    BGE     asout
+    TST.L   D0              ; past pi/2: down
+    BMI     acdn
+    CMP.L   A4,D2           ; y <= t: up
+    BLT     acup
+    BGT     acdn
+    CMP.L   A5,D3
+    BLS     acup
+acdn:
+    BSR     ascd
+    MOVE.L  #$40000000,D6
+    LSR.L   D7,D6           ; z -= 2^-i
+    SUB.L   D6,4(A3)
+    BCC     acnx
+    SUBQ.L  #1,(A3)
+    BRA     acnx
+acup:
+    BSR     ascu
+    MOVE.L  #$40000000,D6
+    LSR.L   D7,D6           ; z += 2^-i
+    ADD.L   D6,4(A3)
+    BCC     acnx
+    ADDQ.L  #1,(A3)
+acnx:
+    ADDQ.W  #1,D7
+    BRA     aclp
+
+asout:
+    MOVE.L  44(A7),A0
+    MOVEM.L D0-D1,(A0)
+    MOVE.L  48(A7),A0
+    MOVEM.L D2-D3,(A0)
+    MOVE.L  56(A7),A0
+    MOVEM.L A4-A5,(A0)
+    MOVEM.L (A7)+,D2-D7/A2-A5
+    RTS
+
+* two turns up, i < 16
+asau:
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    RTS
+
+* two turns down, i < 16
+asad:
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    RTS
+
+* two turns up, 16 <= i < 32
+asbu:
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    RTS
+
+* two turns down, 16 <= i < 32
+asbd:
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    RTS
+
+* two turns up, i >= 32
+ascu:
+    MOVE.L  D2,D4           ; T = y
+    MOVE.L  D4,D5           ; T >>= i: high long only
+    ASR.L   D7,D5
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.L  D4,D5           ; T >>= i: high long only
+    ASR.L   D7,D5
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    MOVE.L  D2,D4           ; T = y
+    MOVE.L  D4,D5           ; T >>= i: high long only
+    ASR.L   D7,D5
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.L  D4,D5           ; T >>= i: high long only
+    ASR.L   D7,D5
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    RTS
+
+* two turns down, i >= 32
+ascd:
+    MOVE.L  D2,D4           ; T = y
+    MOVE.L  D4,D5           ; T >>= i: high long only
+    ASR.L   D7,D5
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.L  D4,D5           ; T >>= i: high long only
+    ASR.L   D7,D5
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    MOVE.L  D2,D4           ; T = y
+    MOVE.L  D4,D5           ; T >>= i: high long only
+    ASR.L   D7,D5
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.L  D4,D5           ; T >>= i: high long only
+    ASR.L   D7,D5
+    ADD.L   D4,D4
+    SUBX.L  D4,D4
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    RTS
+
+* q2hyp(&x, &y, &z, n): n (at most 33) hyperbolic rotation
+* steps on Q2.62 x, y and z for the hyperbolic CORDIC (spft2.c),
+* shifts from 1, with 4 and 13 taken twice:
+*   z >= 0:  x += y >> i,  y += x >> i,  z -= athtb[k]
+*   z <  0:  x -= y >> i,  y -= x >> i,  z += athtb[k]
+* The q2rot step with the signs of the x update turned round;
+* from (1/K, 0) it leaves cosh z and sinh z.
+* A3 counts steps and A0 moves on every step; D7 and A1 stay
+* put on a repeat, and A2 holds the next shift to repeat.
+_q2hyp:
+    MOVEM.L D2-D7/A2-A5,-(A7)
+    MOVE.L  44(A7),A0
+    MOVEM.L (A0),D0-D1      ; x
+    MOVE.L  48(A7),A0
+    MOVEM.L (A0),D2-D3      ; y
+    MOVE.L  52(A7),A0
+    MOVEM.L (A0),A4-A5      ; z
+    SUBA.L  A3,A3           ; k
+    MOVE.W  #4,A2           ; first repeat
+    LEA     _athtb,A0
+    LEA     crdmsk+4,A1
+    MOVEQ   #1,D7           ; i
+
+* shifts 1..15
+hyalp:
+    CMPA.L  56(A7),A3
+    BGE     hyout
+    CMP.W   #16,D7
+    BEQ     hyhi
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    MOVE.L  A4,D6
+    BMI     hyang
+* z >= 0: x += y >> i, y += x >> i, z -= atanh(2^-i)
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    CMPA.L  4(A0),A5        ; z -= athtb[k], borrow by hand
+    BCC     hyanb
+    SUBQ.L  #1,A4
+hyanb:
+    SUBA.L  4(A0),A5
+    SUBA.L  (A0),A4
+    BRA     hyanx
+* z < 0: x -= y >> i, y -= x >> i, z += atanh(2^-i)
+hyang:
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    ADDA.L  4(A0),A5        ; z += athtb[k], carry by hand
+    CMPA.L  4(A0),A5
+    BCC     hyanc
+    ADDQ.L  #1,A4
+hyanc:
+    ADDA.L  (A0),A4
+hyanx:
+    ADDQ.L  #8,A0
+    ADDQ.L  #1,A3
+    CMP.W   A2,D7           ; shift to repeat?
+    BNE     hyanw
+    MOVE.L  A2,D6           ; next: 3i + 1
+    ADD.L   D6,D6
+    ADDA.L  D6,A2
+    ADDQ.L  #1,A2
+    BRA     hyalp
+hyanw:
+    ADDQ.L  #4,A1
+    ADDQ.W  #1,D7
+    BRA     hyalp
+
+* shifts 16..31, no repeats: 16 bits by word moves, then i - 16
+hyhi:
+    MOVEQ   #0,D7           ; i - 16
+    LEA     crdmsk,A1
+hyblp:
+    CMPA.L  56(A7),A3
+    BGE     hyout
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    MOVE.L  A4,D6
+    BMI     hybng
+* z >= 0: x += y >> i, y += x >> i, z -= atanh(2^-i)
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    CMPA.L  4(A0),A5        ; z -= athtb[k], borrow by hand
+    BCC     hybnb
+    SUBQ.L  #1,A4
+hybnb:
+    SUBA.L  4(A0),A5
+    SUBA.L  (A0),A4
+    BRA     hybnx
+* z < 0: x -= y >> i, y -= x >> i, z += atanh(2^-i)
+hybng:
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    ADDA.L  4(A0),A5        ; z += athtb[k], carry by hand
+    CMPA.L  4(A0),A5
+    BCC     hybnc
+    ADDQ.L  #1,A4
+hybnc:
+    ADDA.L  (A0),A4
+hybnx:
+    ADDQ.L  #8,A0
+    ADDQ.L  #4,A1
+    ADDQ.W  #1,D7
+    ADDQ.L  #1,A3
+    BRA     hyblp
+
+hyout:
+    MOVE.L  44(A7),A0
+    MOVEM.L D0-D1,(A0)
+    MOVE.L  48(A7),A0
+    MOVEM.L D2-D3,(A0)
+    MOVE.L  52(A7),A0
+    MOVEM.L A4-A5,(A0)
+    MOVEM.L (A7)+,D2-D7/A2-A5
+    RTS
+
+* q2hvc(&x, &y, &z, n): n (at most 33) hyperbolic vectoring
+* steps, the q2hyp loop steered by the sign of y instead of z
+* (atnh, asnh and acnh in spft2.c):
+*   y <  0:  x += y >> i,  y += x >> i,  z -= athtb[k]
+*   y >= 0:  x -= y >> i,  y -= x >> i,  z += athtb[k]
+* y goes to 0, z gathers atanh(y/x) and x ends at
+* K sqrt(x^2 - y^2).  It leaves through hyout.
+_q2hvc:
+    MOVEM.L D2-D7/A2-A5,-(A7)
+    MOVE.L  44(A7),A0
+    MOVEM.L (A0),D0-D1      ; x
+    MOVE.L  48(A7),A0
+    MOVEM.L (A0),D2-D3      ; y
+    MOVE.L  52(A7),A0
+    MOVEM.L (A0),A4-A5      ; z
+    SUBA.L  A3,A3           ; k
+    MOVE.W  #4,A2           ; first repeat
+    LEA     _athtb,A0
+    LEA     crdmsk+4,A1
+    MOVEQ   #1,D7           ; i
+
+* shifts 1..15
+hvalp:
+    CMPA.L  56(A7),A3
+    BGE     hyout
+    CMP.W   #16,D7
+    BEQ     hvhi
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    TST.L   D2
+    BPL     hvang
+* y < 0: x += y >> i, y += x >> i, z -= atanh(2^-i)
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    CMPA.L  4(A0),A5        ; z -= athtb[k], borrow by hand
+    BCC     hvanb
+    SUBQ.L  #1,A4
+hvanb:
+    SUBA.L  4(A0),A5
+    SUBA.L  (A0),A4
+    BRA     hvanx
+* y >= 0: x -= y >> i, y -= x >> i, z += atanh(2^-i)
+hvang:
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    LSR.L   D7,D5           ; T >>= i
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    ADDA.L  4(A0),A5        ; z += athtb[k], carry by hand
+    CMPA.L  4(A0),A5
+    BCC     hvanc
+    ADDQ.L  #1,A4
+hvanc:
+    ADDA.L  (A0),A4
+hvanx:
+    ADDQ.L  #8,A0
+    ADDQ.L  #1,A3
+    CMP.W   A2,D7           ; shift to repeat?
+    BNE     hvanw
+    MOVE.L  A2,D6           ; next: 3i + 1
+    ADD.L   D6,D6
+    ADDA.L  D6,A2
+    ADDQ.L  #1,A2
+    BRA     hvalp
+hvanw:
+    ADDQ.L  #4,A1
+    ADDQ.W  #1,D7
+    BRA     hvalp
+
+* shifts 16..31, no repeats: 16 bits by word moves, then i - 16
+hvhi:
+    MOVEQ   #0,D7           ; i - 16
+    LEA     crdmsk,A1
+hvblp:
+    CMPA.L  56(A7),A3
+    BGE     hyout
+    MOVE.L  D2,D4
+    MOVE.L  D3,D5           ; T = y
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    TST.L   D2
+    BPL     hvbng
+* y < 0: x += y >> i, y += x >> i, z -= atanh(2^-i)
+    ADD.L   D5,D1
+    ADDX.L  D4,D0
+    NEG.L   D5
+    NEGX.L  D4
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    ADD.L   D5,D3
+    ADDX.L  D4,D2
+    CMPA.L  4(A0),A5        ; z -= athtb[k], borrow by hand
+    BCC     hvbnb
+    SUBQ.L  #1,A4
+hvbnb:
+    SUBA.L  4(A0),A5
+    SUBA.L  (A0),A4
+    BRA     hvbnx
+* y >= 0: x -= y >> i, y -= x >> i, z += atanh(2^-i)
+hvbng:
+    SUB.L   D5,D1
+    SUBX.L  D4,D0
+    ADD.L   D1,D5
+    ADDX.L  D0,D4           ; T = old x
+    MOVE.W  D4,D5           ; T >>= 16
+    SWAP    D5
+    SWAP    D4
+    EXT.L   D4
+    LSR.L   D7,D5           ; T >>= i - 16
+    MOVE.L  D4,D6
+    ASR.L   D7,D4
+    ROR.L   D7,D6
+    AND.L   (A1),D6         ; low i - 16 bits of the high long
+    OR.L    D6,D5
+    SUB.L   D5,D3
+    SUBX.L  D4,D2
+    ADDA.L  4(A0),A5        ; z += athtb[k], carry by hand
+    CMPA.L  4(A0),A5
+    BCC     hvbnc
+    ADDQ.L  #1,A4
+hvbnc:
+    ADDA.L  (A0),A4
+hvbnx:
+    ADDQ.L  #8,A0
+    ADDQ.L  #4,A1
+    ADDQ.W  #1,D7
+    ADDQ.L  #1,A3
+    BRA     hvblp
+
+* top k bits set, k = 0..15
+    .even
+crdmsk:
+    .dc.l   $00000000
+    .dc.l   $80000000
+    .dc.l   $C0000000
+    .dc.l   $E0000000
+    .dc.l   $F0000000
+    .dc.l   $F8000000
+    .dc.l   $FC000000
+    .dc.l   $FE000000
+    .dc.l   $FF000000
+    .dc.l   $FF800000
+    .dc.l   $FFC00000
+    .dc.l   $FFE00000
+    .dc.l   $FFF00000
+    .dc.l   $FFF80000
+    .dc.l   $FFFC0000
+    .dc.l   $FFFE0000
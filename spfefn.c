@@ -30,158 +30,456 @@
 
 #define spf_15	0x3e19999aL
 #define spf_48	0x3ef5c28fL
-#define spf_2	0x40000000L
-#define spf_3	0x40400000L
-#define spf_4	0x40800000L
-#define spf_5	0x40A00000L
-#define spf_6	0x40C00000L
-#define spf_7	0x40E00000L
-
-// exp(x) — return e^x where 0 < x < 1
-spf exp(x)
+
+// exp coefficients 1/k!, k = 0..10, as spx, spftbl.s (mktbl.c)
+extern spx exptb[];
+
+// e^x = 2^k e^r, x = k ln2 + r, |r| <= ln2/2.  k is x / ln2
+// rounded, r is taken off in two steps (Cody and Waite): ln2 to
+// 24 bits, whose product with k is exact, then the rest of ln2,
+// so r is good to 32 bits.  e^r is the series to r^8/8! from
+// exptb, within 2^-32 of e^r on that interval and with no
+// division; 2^k goes straight into the spx exponent and the chain
+// is rounded once, so overflow and underflow come out of spx_fp.
+#define LOG2EM	0xB8AA3B29L	// log2(e) as spx: man, expo 0
+#define LN2HM	0xB1721800L	// ln2 to 24 bits: man, expo -1
+#define LN2LM	0x82E30865L	// ln2 - that, negative: man, expo -29
+#define NEXPS	8		// series to r^NEXPS / NEXPS!
+#define SPXZE	(-16384)	// spx zero exponent (spfspx.s)
+
+// ltspx — r = n as spx, exact
+static void ltspx(r, n)
+spx *r;
+long n;
+{
+	unsigned long m;
+
+	r->sign = (n < 0L) ? -1 : 0;
+	m = (unsigned long)((n < 0L) ? -n : n);
+	if (m == 0L) {
+		r->expo = SPXZE;
+		r->man = 0L;
+		return;
+	}
+	r->expo = 31;
+	while ((long)m > 0L) {
+		m <<= 1;
+		r->expo--;
+	}
+	r->man = (long)m;
+}
+
+// spxrnd — a rounded to the nearest integer, half away from zero;
+// |a| < 2^30
+static long spxrnd(a)
+spx *a;
+{
+	unsigned long m;
+	long k;
+
+	if (a->man == 0L || a->expo < -1) return 0L;
+	m = (unsigned long)a->man >> (30 - a->expo);
+	k = (long)((m + 1L) >> 1);
+	return (a->sign) ? -k : k;
+}
+
+// expser — r = e^a from the exptb series, |a| <= ln2/2
+static void expser(r, a)
+spx *r;
+spx *a;
+{
+	int i;
+
+	spxfma(r, a, &exptb[NEXPS], &exptb[NEXPS - 1]);
+	for (i = NEXPS - 2; i >= 0; i--)
+		spxfma(r, a, r, &exptb[i]);
+}
+
+// lnred — x = k ln2 + r, |r| <= ln2/2: r in spx, returns k.  Also
+// the reduction for the hyperbolic CORDIC (spft2.c).
+long lnred(r, x)
+spx *r;
+spf x;
+{
+	spx c;
+	spx t;
+	long k;
+
+	fpspx(r, x);
+	c.sign = 0;
+	c.expo = 0;
+	c.man = LOG2EM;
+	spxmul(&t, r, &c);
+	k = spxrnd(&t);
+	if (k != 0L) {
+		// the two steps add (-k) * ln2
+		ltspx(&t, -k);
+		c.sign = 0;
+		c.expo = -1;
+		c.man = LN2HM;
+		spxfma(r, &t, &c, r);
+		c.sign = -1;
+		c.expo = -29;
+		c.man = LN2LM;
+		spxfma(r, &t, &c, r);
+	}
+	return k;
+}
+
+static spf expr(x)
 spf x;
 {
-	spf t;
-	t = spfadd(spfone, spfdiv(x, spf_7));
-	t = spfadd(spfone, spfmul(spfdiv(x, spf_6), t));
-	t = spfadd(spfone, spfmul(spfdiv(x, spf_5), t));
-	t = spfadd(spfone, spfmul(spfdiv(x, spf_4), t));
-	t = spfadd(spfone, spfmul(spfdiv(x, spf_3), t));
-	t = spfadd(spfone, spfmul(spfdiv(x, spf_2), t));
-	t = spfadd(spfone, spfmul(x, t));
-	return t;
+	spx r;
+	spx t;
+	long k;
+
+	k = lnred(&r, x);
+	expser(&t, &r);
+	t.expo += (int)k;
+	return spx_fp(&t);
 }
 
 // spfexp — general-purpose e^x for floating point values
 spf spfexp(val)
 spf val;
 {
-	long i;
-	q4f frac, wfq4;
-	spf work;
-	spf workf;
-	spf j;
-	work = spfabs(val);
-	if (spfeq(val, spfz)) {
-		return spfone;
-	} else if (spfeq(val, spfone)) {
-		work = spfe;
+	if ((val & 0x7FFFFFFFL) > 0x7F800000L) return val;	// NaN
+	if ((val & 0x7FFFFFFFL) >= SPFEXB) {
+		// past spf as spx_fp would have it; +-inf are exact
+		if (val < 0L) {
+			if (val != 0xFF800000L) spfrse(SPFUNF | SPFINX);
+			return spfz;
+		}
+		if (val != 0x7F800000L) spfrse(SPFOVF | SPFINX);
+		return 0x7F800000L;
+	}
+	return expr(val);
+}
+
+// log2 tables, spftbl.s (mktbl.c): lg2tb pairs c, -log2 c for
+// j = LG2J0..LG2J1, lg2pc (-1)^(k+1) / (k ln2), lg2cv ln2, log10(2)
+extern spx lg2tb[];
+extern spx lg2pc[];
+extern spx lg2cv[];
+
+// log2 x = e + log2 u, x = 2^e u, u in [sqrt(1/2), sqrt(2)).  j is
+// 32u rounded, c = 1/u to 8 bits from lg2tb, so r = u c - 1 is
+// exact (24 by 8 bits) and |r| < 0.027; log2(1 + r) is the series
+// to r^6 / 6 from lg2pc, within 2^-34 of it.  Then - log2 c and e
+// are added; |e + log2 u| >= 1/2 whenever e is not 0, so neither
+// add loses bits.  All in spx, for the caller to scale and round;
+// lg2k leaves out e and returns it.
+#define LG2J0	23
+#define SQ2M	0xB504F4L	// sqrt(2) as a 24-bit mantissa
+
+static long lg2k(r, x)
+spx *r;
+spf x;
+{
+	spx u;
+	spx t;
+	spx *cp;
+	unsigned long m;
+	long e;
+	int i;
+
+	e = ((x >> 23) & 0xFFL) - 127L;
+	m = (unsigned long)(x & 0x007FFFFFL);
+	if (e == -127L) {
+		// denormal: normalize by hand
+		e++;
+		while (m < 0x00800000L) {
+			m <<= 1;
+			e--;
+		}
+	}
+	m |= 0x00800000L;
+	u.sign = 0;
+	u.man = (long)(m << 8);
+	if (m >= SQ2M) {
+		u.expo = -1;
+		e++;
+		i = (int)((m + 0x40000L) >> 19);
 	} else {
-		workf = spfint(work);
-		i = spflng(workf);
-		workf = spfsub(work, workf);
-		workf = exp(workf);
-		work = spfpowi(spfe, i);
-		work = spfmul(work, workf);
+		u.expo = 0;
+		i = (int)((m + 0x20000L) >> 18);
 	}
-	if (spflt(val,spfz)) {
-		work = spfdiv(spfone, work);
+	cp = &lg2tb[2 * (i - LG2J0)];
+	t.sign = -1;
+	t.expo = 0;
+	t.man = 0x80000000L;
+	spxfma(&u, &u, cp, &t);		// r = u c - 1
+	spxfma(&t, &u, &lg2pc[5], &lg2pc[4]);
+	for (i = 3; i >= 0; i--)
+		spxfma(&t, &u, &t, &lg2pc[i]);
+	spxmul(&t, &t, &u);
+	spxadd(r, &t, cp + 1);
+	return e;
+}
+
+static void lg2x(r, x)
+spx *r;
+spf x;
+{
+	spx u;
+	long e;
+
+	e = lg2k(r, x);
+	if (e != 0L) {
+		ltspx(&u, e);
+		spxadd(r, r, &u);
 	}
-	return work;
 }
 
-// logn — natural logarithm using atanh series on (r/(2+r))
-q4f logn(x)
-q4f x;
+// lgspc — the log functions at x <= 0 (NaN), +inf and NaN (x);
+// returns 0 for a positive finite x, which goes to lg2x
+static int lgspc(x, rp)
+spf x;
+spf *rp;
 {
-	spf r, z, z2, term, sum;
-	spf result;
+	if (x <= 0L) {
+		*rp = spfNAN;
+		return 1;
+	}
+	if (x >= 0x7F800000L) {
+		*rp = x;
+		return 1;
+	}
+	return 0;
+}
 
-#define F_2	0x40000000L
-#define F_3	0x40400000L
-#define F_5	0x40A00000L
-#define F_7	0x40E00000L
-#define F_9	0x41100000L
-#define F_11	0x41300000L
-#define F_13	0x41500000L
-
-	// r = x - 1
-	r = spfsub(x, spfone);
-	// z = r / (2 + r)
-	z = spfdiv(r, spfadd(F_2, r));
-	// start with sum = z
-	sum = z;
-	term = z;
-	// z^3 / 3
-	z2 = spfmul(z, z);
-	term = spfmul(term, z2);
-	sum = spfadd(sum, spfdiv(term, F_3));
-	// z^5 / 5
-	term = spfmul(term, z2);
-	sum = spfadd(sum, spfdiv(term, F_5));
-	// z^7 / 7
-	term = spfmul(term, z2);
-	sum = spfadd(sum, spfdiv(term, F_7));
-	// z^9 / 9
-	term = spfmul(term, z2);
-	sum = spfadd(sum, spfdiv(term, F_9));
-	// z^11 / 11
-	term = spfmul(term, z2);
-	sum = spfadd(sum, spfdiv(term, F_11));
-	// z^13 / 13
-	term = spfmul(term, z2);
-	sum = spfadd(sum, spfdiv(term, F_13));
-	result = spfadd(sum, sum);
-	return result;
+spf spflg2(val)
+spf val;
+{
+	spx t;
+	spf r;
+
+	if (lgspc(val, &r)) return r;
+	lg2x(&t, val);
+	return spx_fp(&t);
 }
 
+// spfln and spflog scale log2 x by ln2 or log10(2) in spx, so
+// each is rounded once
 spf spfln(val)
 spf val;
 {
-    unsigned long w1;
-    long e;
-    spf expf, ln2_exp, mant, ln_m, result;
+	spx t;
+	spf r;
 
-    if (spfle(val, spfz)) return spfNAN;   /* x <= 0 -> NaN */
+	if (lgspc(val, &r)) return r;
+	lg2x(&t, val);
+	spxmul(&t, &t, &lg2cv[0]);
+	return spx_fp(&t);
+}
 
-    /* bit extract */
-    w1 = (unsigned long)val;
+spf spflog(val)
+spf val;
+{
+	spx t;
+	spf r;
 
-    /* unbiased exponent e = E - 127  */
-    e = (long)((w1 & (unsigned long) 0x7F800000L) >> 23) - 127L;
-    expf = spfltf(e);
-    ln2_exp = spfmul(expf, spfl2);         /* e * ln(2) */
+	if (lgspc(val, &r)) return r;
+	lg2x(&t, val);
+	spxmul(&t, &t, &lg2cv[1]);
+	return spx_fp(&t);
+}
 
-    /* mantissa in [1,2): put hidden 1 back, force exponent=127 */
-    mant = (spf)((w1 & (unsigned long) 0x007FFFFFL) | (unsigned long) 0x3F800000L);
+#define F_2	0x40000000L
 
-    if (spfeq(mant, spfone)) {
-        ln_m = spfz;
-    } else {
-        ln_m = logn(mant);                  /* series on [1,2) */
-    }
+// Unchecked entry points for arguments the caller has already
+// reduced: spflnu needs x in [1, 2), spfexu |x| <= 87, where
+// e^x is a normal spf.  No sign, zero, NaN or range handling.
+// Build with CHKPRE to have each call check its precondition,
+// report and return NaN.
+//#define CHKPRE 1
+#define EXPU	0x42AE0000L	// 87
+
+spf spflnu(x)
+spf x;
+{
+	spx t;
 
-    result = spfadd(ln2_exp, ln_m);
-    return result;
+#ifdef CHKPRE
+	if (x < spfone || x >= F_2) {
+		printf("spflnu: 0x%08lX not in [1, 2)\n", (unsigned long)x);
+		return spfNAN;
+	}
+#endif
+	lg2x(&t, x);
+	spxmul(&t, &t, &lg2cv[0]);
+	return spx_fp(&t);
 }
 
+spf spfexu(x)
+spf x;
+{
+#ifdef CHKPRE
+	if ((x & 0x7FFFFFFFL) > EXPU) {
+		printf("spfexu: 0x%08lX not in [-87, 87]\n", (unsigned long)x);
+		return spfNAN;
+	}
+#endif
+	return expr(x);
+}
 
-spf spflog(val)
-spf val;
+// spvexp — r[i] = e^a[i], n elements, bit-identical to spfexp.
+void spvexp(r, a, n)
+spf *r;
+spf *a;
+long n;
 {
-	spf wf;
-	wf = spfln(val);
-	wf = spfdiv(wf, spfl10);
-	return wf;
+	long k;
+
+	for (k = 0L; k < n; k++)
+		r[k] = spfexp(a[k]);
 }
 
-spf spflg2(val)
-spf val;
+// spvln — r[i] = ln a[i], n elements, bit-identical to spfln.
+void spvln(r, a, n)
+spf *r;
+spf *a;
+long n;
 {
-	spf wf;
-	wf = spfln(val);
-	wf = spfdiv(wf, spfl2);
-	return wf;
+	long k;
+
+	for (k = 0L; k < n; k++)
+		r[k] = spfln(a[k]);
+}
+
+// spfpow — x^y.  An integer y with |y| <= NPOWI is repeated
+// squaring and a half integer that plus one square root, both in
+// spx; a negative x needs an integer y and takes its sign from an
+// odd one.  Otherwise x^y = 2^w, w = y log2|x| = y e + y f with f
+// = log2 u from lg2k: y e is exact, k = w rounded is taken off it
+// before y f is added, so r = w - k is good to 32 bits whatever
+// the size of w, and 2^r 2^k is the exp series on r ln2, rounded
+// once.
+#define NPOWI	64L		// integer and half-integer fast paths
+#define SPFINF	0x7F800000L
+
+// pwisq — r = r a^n, n >= 0, by repeated squaring; a is used up
+static void pwisq(r, a, n)
+spx *r;
+spx *a;
+long n;
+{
+	while (n != 0L) {
+		if (n & 1L) spxmul(r, r, a);
+		n >>= 1;
+		if (n != 0L) spxmul(a, a, a);
+	}
+}
+
+// pwsqr — r = sqrt(x), x > 0: spfsqr to 24 bits and one Newton
+// step in spx
+static void pwsqr(r, x)
+spx *r;
+spf x;
+{
+	spx u;
+	spx t;
+
+	fpspx(&u, x);
+	fpspx(r, spfsqr(x));
+	spxdiv(&t, &u, r);
+	spxadd(r, r, &t);
+	r->expo--;
 }
 
 spf spfpow(x, y)
 spf x;
 spf y;
 {
-	spf result;
-	result = spfln(x);
-	result = spfmul(result, y);
-	result = spfexp(result);
-	return result;
-}
+	spx u;
+	spx t;
+	spx v;
+	spx w;
+	long ax;
+	long ay;
+	long ey;
+	long n;
+	long k;
+	int half;
+	int neg;
+
+	ax = x & 0x7FFFFFFFL;
+	ay = y & 0x7FFFFFFFL;
+	if (ay == 0L || x == spfone) return spfone;
+	if (ax > SPFINF || ay > SPFINF) return spfNAN;
+
+	// y: n = |y| when an integer below 2^24 (n odd: neg may be
+	// set), or |y| - 1/2 with half set; n = -1 otherwise
+	ey = (ay >> 23) - 127L;
+	n = -1L;
+	half = 0;
+	neg = 0;
+	if (ey >= 24L) {
+		n = 0L;			// even, and past the fast paths
+	} else if (ey >= -1L) {
+		k = (ay & 0x007FFFFFL) | 0x00800000L;
+		if ((k & ((1L << (23 - ey)) - 1L)) == 0L) {
+			n = k >> (23 - ey);
+			if (x < 0L && (n & 1L)) neg = 1;
+		} else if (ey <= 22L &&
+			(k & ((1L << (23 - ey)) - 1L)) == (1L << (22 - ey))) {
+			n = k >> (23 - ey);
+			half = 1;
+		}
+	}
+	if (x < 0L && (n < 0L || half) && ax != 0L && ax != SPFINF)
+		return spfNAN;
+
+	// zero, inf, and |x| = 1 to an infinite y
+	if (ax == 0L || ax == SPFINF) {
+		if (ax == 0L && y < 0L) spfrse(SPFDZ);
+		k = ((ax == 0L) == (y < 0L)) ? SPFINF : 0L;
+		return (neg) ? (k | 0x80000000L) : k;
+	}
+	if (ay == SPFINF) {
+		if (ax == spfone) return spfone;
+		return ((ax < spfone) == (y < 0L)) ? SPFINF : spfz;
+	}
 
+	fpspx(&u, ax);
+	if (n >= 0L && n <= NPOWI && (ey < 24L)) {
+		if (half) {
+			pwsqr(&t, ax);
+		} else {
+			t.sign = 0;
+			t.expo = 0;
+			t.man = 0x80000000L;
+		}
+		pwisq(&t, &u, n);
+		if (y < 0L) {
+			fpspx(&u, spfone);
+			spxdiv(&t, &u, &t);
+		}
+	} else {
+		// w = y e + y f; k = w rounded, r = (y e - k) + y f
+		fpspx(&u, y);
+		ltspx(&v, lg2k(&t, ax));
+		spxmul(&v, &u, &v);
+		spxfma(&w, &u, &t, &v);
+		if (w.man != 0L && w.expo >= 8) {	// |w| >= 256
+			// past spf: the flags spx_fp would raise
+			if (w.sign) {
+				spfrse(SPFUNF | SPFINX);
+				k = 0L;
+			} else {
+				spfrse(SPFOVF | SPFINX);
+				k = SPFINF;
+			}
+			return (neg) ? (k | 0x80000000L) : k;
+		}
+		k = spxrnd(&w);
+		ltspx(&w, -k);
+		spxadd(&v, &v, &w);
+		spxfma(&w, &u, &t, &v);
+		spxmul(&w, &w, &lg2cv[0]);
+		expser(&t, &w);
+		t.expo += (int)k;
+	}
+	if (neg) t.sign = -1;
+	return spx_fp(&t);
+}
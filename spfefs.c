@@ -417,7 +417,6 @@ long y;
 			c = h * h;
 		} else {
 			c = h * h * x;
-			printf("took odd branch:\n");
 		}
 	}
 	return c;
@@ -0,0 +1,63 @@
+*-----------------------------------------------------------
+* Title      : spfenv.s
+* Written by : J. Lovrinic
+* Date       : 20261017
+*              sticky status flags for the floating point
+*              library: spfenv, spftst, spfclr
+*
+*   spfenv is the library's only writable state, one word of
+*   flags (SPFINV, SPFDZ, SPFOVF, SPFUNF, SPFINX in spflib.h).
+*   Routines raise a flag with a single OR to memory, which
+*   the 68000 cannot interrupt part way, so the library may
+*   be called from interrupt handlers without losing a flag.
+*   Flags stay set until cleared; clear only the bits that
+*   were tested so a flag raised in between is kept.
+*   This object goes last in spflib, after every user.
+*-----------------------------------------------------------
+**********************************************************/
+* Copyright 2025 John J Lovrinic                         */
+* Permission is hereby granted, free of charge,          */     
+* to any person obtaining a copy of this software        */
+* and associated documentation files (the “Software”),   */
+* to deal in the Software without restriction,           */
+* including without limitation the rights to use,        */
+* copy, modify, merge, publish, distribute, sublicense,  */
+* and/or sell copies of the Software, and to permit      */
+* persons to whom the Software is furnished to do so,    */
+* subject to the following conditions:                   */
+*                                                        */
+* The above copyright notice and this permission notice  */
+* shall be included in all copies or substantial         */
+* portions of the Software.                              */
+*                                                        */
+* THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY     */
+* OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT     */
+* LIMITED TO THE WARRANTIES OF MERCHANTABILITY,          */
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  */
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS     */
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,   */
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,   */
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE         */
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+**********************************************************/
+    .globl      _spfenv
+    .globl      _spftst
+    .globl      _spfclr
+
+_spftst:
+*   long spftst(mask) - the set flags selected by mask
+    MOVEQ   #0,D0
+    MOVE.W  _spfenv,D0
+    AND.L   4(A7),D0
+    RTS
+
+_spfclr:
+*   spfclr(mask) - clear the flags selected by mask
+    MOVE.L  4(A7),D0
+    NOT.W   D0
+    AND.W   D0,_spfenv
+    RTS
+
+    .bss
+_spfenv:
+    .ds.w   1
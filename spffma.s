@@ -0,0 +1,407 @@
+*-----------------------------------------------------------
+* Title      : spffma.s
+* Written by : J. Lovrinic
+* Date       : 20261017
+*              fused multiply-add: spffma(a,b,c) = a*b + c
+*              with a single rounding
+*
+*   The 48-bit product comes from the same four MULU partial
+*   products as spfmul and is never rounded.  It is placed
+*   in a 64-bit register pair with the addend beside it,
+*   the smaller one shifted right with the lost bits jammed
+*   into bit 0, and the exact sum is normalized and rounded
+*   once to nearest-even.  Specials follow spfmul/spfadd:
+*   NaN in gives spfNAN, inf*0 and inf-inf give spfNAN with
+*   SPFINV, overflow gives a signed infinity and underflow
+*   (and denormal operands) +0.  SPFOVF, SPFUNF and SPFINX
+*   are raised in spfenv.  D2-D7 are saved.
+*
+*   Cycle counts (68000, no wait states, JSR not included):
+*                       spffma          spfmul+spfadd
+*     same signs        1274-1462       1318-1438
+*       average         1383            1374
+*     opposite signs    1262-1718       1328-1512
+*       average         1501            1399
+*     cancellation      1276-1848       1202-1580
+*       average         1491            1520
+*   (spfmul+spfadd is two calls: add about 60 for the second
+*   JSR and its argument pushes.)  The gain is one rounding
+*   instead of two, and one call per Horner step.
+*-----------------------------------------------------------
+**********************************************************/
+* Copyright 2025 John J Lovrinic                         */
+* Permission is hereby granted, free of charge,          */     
+* to any person obtaining a copy of this software        */
+* and associated documentation files (the “Software”),   */
+* to deal in the Software without restriction,           */
+* including without limitation the rights to use,        */
+* copy, modify, merge, publish, distribute, sublicense,  */
+* and/or sell copies of the Software, and to permit      */
+* persons to whom the Software is furnished to do so,    */
+* subject to the following conditions:                   */
+*                                                        */
+* The above copyright notice and this permission notice  */
+* shall be included in all copies or substantial         */
+* portions of the Software.                              */
+*                                                        */
+* THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY     */
+* OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT     */
+* LIMITED TO THE WARRANTIES OF MERCHANTABILITY,          */
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  */
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS     */
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,   */
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,   */
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE         */
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+**********************************************************/
+    .globl      _spffma
+    .globl      _spfenv
+
+* sticky status flags, as in spflib.h
+SPFINV  .equ    $0001
+SPFOVF  .equ    $0004
+SPFUNF  .equ    $0008
+SPFINX  .equ    $0010
+
+_spffma:
+*   a at 4(A7), b at 8(A7), c at 12(A7)
+    MOVE.L  4(A7),D0
+    MOVE.L  8(A7),D1
+    MOVEM.L D2-D7,-(A7)
+    MOVE.L  36(A7),D6       ; c (12 + 24 bytes of saved registers)
+
+* Step 1: product sign into bit 31 of D5, exponents as (e << 7)
+    MOVE.L  D0,D5
+    EOR.L   D1,D5
+    MOVE.L  D0,D2
+    SWAP    D2
+    MOVE.L  D1,D3
+    SWAP    D3
+    MOVE.L  D6,D7
+    SWAP    D7
+    AND.W   #$7F80,D7       ; D7 = ec << 7
+    MOVE.W  D2,D5
+    AND.W   #$7F80,D5
+    BEQ     fspec           ; a is zero
+    CMP.W   #$7F80,D5
+    BEQ     fspec           ; a is inf/NaN
+    MOVE.W  D3,D4
+    AND.W   #$7F80,D4
+    BEQ     fspec           ; b is zero
+    CMP.W   #$7F80,D4
+    BEQ     fspec           ; b is inf/NaN
+    CMP.W   #$7F80,D7
+    BEQ     fspec           ; c is inf/NaN
+    ADD.W   D4,D5           ; (ea + eb) << 7
+
+* Step 2: 48-bit product in D4:D0, as in spfmul
+    AND.W   #$007F,D2
+    OR.W    #$0080,D2       ; D2 = ah (8 bits)
+    AND.W   #$007F,D3
+    OR.W    #$0080,D3       ; D3 = bh (8 bits)
+    MOVE.W  D3,D4
+    MULU    D2,D4           ; D4 = ah*bh
+    MULU    D1,D2           ; D2 = ah*bl
+    MULU    D0,D3           ; D3 = al*bh
+    MULU    D1,D0           ; D0 = al*bl
+    ADD.L   D3,D2           ; D2 = cross terms (< 2^25)
+    SWAP    D2
+    MOVEQ   #0,D3
+    MOVE.W  D2,D3
+    CLR.W   D2
+    ADD.L   D2,D0
+    ADDX.L  D3,D4
+
+* Step 3: sigProd in D2:D3 with its leading bit at bit 61,
+*         D5.w = product exponent (ea + eb - 126 for that scaling)
+    MOVE.L  D4,D2
+    SWAP    D2
+    MOVE.L  D0,D3
+    SWAP    D3
+    MOVE.W  D3,D2           ; D2:D3 = product << 16
+    CLR.W   D3
+    LSR.W   #7,D5
+    SUB.W   #127,D5
+    TST.L   D2
+    BPL     fp15            ; product < 2: one shift
+    ADDQ.W  #1,D5
+    LSR.L   #1,D2
+    ROXR.L  #1,D3
+fp15:
+    LSR.L   #1,D2
+    ROXR.L  #1,D3
+
+* Step 4: addend; a zero c rounds the product alone
+    TST.W   D7
+    BEQ     fczero
+    LSR.W   #7,D7           ; D7.w = ec
+    MOVE.L  D6,D1
+    EOR.L   D5,D1           ; bit 31 of D1: signs differ
+    AND.L   #$007FFFFF,D6
+    BSET    #23,D6
+    LSL.L   #6,D6           ; D6 = sigC, leading bit at 29 (61 as D6:0)
+    MOVE.W  D5,D1
+    SUB.W   D7,D1           ; D1.w = expDiff = expProd - expC
+    TST.L   D1
+    BMI     fdiff
+
+* Step 5: same signs
+    TST.W   D1
+    BGT     fsbig
+    MOVE.W  D7,D5           ; c dominates: expZ = expC
+    NEG.W   D1
+    BSR     fsrj            ; sigProd >> (32 - expDiff), jammed
+    MOVE.L  D2,D0
+    TST.L   D3
+    BEQ     fsadd
+    BSET    #0,D0
+fsadd:
+    ADD.L   D6,D0
+    BRA     fsnorm
+fsbig:
+    BSR     fcsh            ; sigProd + (sigC:0 >> expDiff), jammed
+    MOVE.L  A1,D0
+    ADD.L   D0,D3
+    MOVE.L  A0,D0
+    ADDX.L  D0,D2
+    MOVE.L  D2,D0
+    TST.L   D3
+    BEQ     fsnorm
+    BSET    #0,D0
+fsnorm:
+    BTST    #30,D0
+    BNE     fround
+    ADD.L   D0,D0
+    SUBQ.W  #1,D5
+    BRA     fround
+
+* Step 6: signs differ
+fdiff:
+    TST.W   D1
+    BGT     fdbig
+    BEQ     fdeq
+    BCHG    #31,D5          ; c dominates: its sign and exponent
+    MOVE.W  D7,D5
+    NEG.W   D1
+    BSR     fsrj            ; sigProd >> -expDiff, jammed
+    NEG.L   D3
+    NEGX.L  D2
+    ADD.L   D6,D2           ; D2:D3 = sigC:0 - sigProd
+    BRA     fnorm
+fdeq:
+    SUB.L   D6,D2           ; same exponent
+    BNE     fdeq1
+    TST.L   D3
+    BEQ     fzero           ; exact cancellation gives +0
+fdeq1:
+    TST.L   D2
+    BPL     fnorm
+    NEG.L   D3              ; c was larger: negate, flip the sign
+    NEGX.L  D2
+    BCHG    #31,D5
+    BRA     fnorm
+fdbig:
+    BSR     fcsh            ; sigProd - (sigC:0 >> expDiff), jammed
+    NEG.L   D3
+    NEGX.L  D2
+    MOVE.L  A1,D0
+    ADD.L   D0,D3
+    MOVE.L  A0,D0
+    ADDX.L  D0,D2
+
+* Step 7: normalize D2:D3 so that bit 62 is set, then fold to 32 bits
+fnorm:
+    TST.L   D2
+    BNE     fnrm8
+    MOVE.L  D3,D2           ; a word of cancellation: shift by 31
+    LSR.L   #1,D2
+    MOVEQ   #0,D3
+    ROXR.L  #1,D3
+    SUB.W   #31,D5
+fnrm8:
+    MOVE.L  D2,D0
+    AND.L   #$7F800000,D0
+    BNE     fnrm1
+    LSL.L   #8,D2           ; 8 bits at a time
+    ROL.L   #8,D3
+    MOVE.B  D3,D2
+    CLR.B   D3
+    SUBQ.W  #8,D5
+    BRA     fnrm8
+fnrm1:
+    BTST    #30,D2
+    BNE     fnrmx
+    ADD.L   D3,D3
+    ADDX.L  D2,D2
+    SUBQ.W  #1,D5
+    BRA     fnrm1
+fnrmx:
+    MOVE.L  D2,D0
+    TST.L   D3
+    BEQ     fround
+    BSET    #0,D0
+    BRA     fround
+
+fczero:
+    SUBQ.W  #1,D5           ; product alone: sigProd >> 31, jammed
+    ADD.L   D3,D3
+    ADDX.L  D2,D2
+    MOVE.L  D2,D0
+    TST.L   D3
+    BEQ     fround
+    BSET    #0,D0
+
+* Step 8: D0 has its leading bit at 30 and 7 round bits; D5.w = expZ
+fround:
+    TST.W   D5
+    BMI     funf            ; underflow
+    CMP.W   #$00FD,D5
+    BCS     frnd
+    BHI     fovf
+    MOVE.L  D0,D4
+    ADD.L   #$00000040,D4
+    BMI     fovf            ; rounds up to infinity
+frnd:
+    MOVEQ   #$7F,D4
+    AND.B   D0,D4           ; round bits
+    BEQ     fexact
+    OR.W    #SPFINX,_spfenv
+    ADD.L   #$00000040,D0
+    LSR.L   #7,D0
+    CMP.B   #$40,D4
+    BNE     fpack
+    BCLR    #0,D0           ; tie: round to even
+    BRA     fpack
+fexact:
+    LSR.L   #7,D0
+fpack:
+    MOVE.W  D5,D4           ; hidden bit carries expZ up by one
+    LSL.W   #7,D4
+    SWAP    D4
+    CLR.W   D4
+    ADD.L   D4,D0
+    TST.L   D5
+    BPL     ffin
+    BSET    #31,D0
+    BRA     ffin
+
+* fsrj: D2:D3 >>= D1.w (0-63+) with lost bits jammed into bit 0;
+*       whole words, then a SWAP for 16, then rotate and mask
+fsrj:
+    MOVEQ   #0,D4           ; bits shifted out
+    CMP.W   #62,D1
+    BCC     fsrjb
+    CMP.W   #32,D1
+    BCS     fsrj16
+    MOVE.L  D3,D4           ; a whole word first
+    MOVE.L  D2,D3
+    MOVEQ   #0,D2
+    SUB.W   #32,D1
+fsrj16:
+    CMP.W   #16,D1
+    BCS     fsrjs
+    OR.W    D3,D4           ; 16 bits by swapping halves
+    MOVE.W  D2,D3
+    SWAP    D3
+    CLR.W   D2
+    SWAP    D2
+    SUB.W   #16,D1
+    BEQ     fsrjj
+fsrjs:
+    MOVEQ   #-1,D0
+    LSR.L   D1,D0           ; D0 = bits that stay in each word
+    ROR.L   D1,D3
+    MOVE.L  D3,D7
+    AND.L   D0,D3
+    EOR.L   D3,D7           ; low bits rotated out of the pair
+    OR.L    D7,D4
+    ROR.L   D1,D2
+    MOVE.L  D2,D7
+    AND.L   D0,D2
+    EOR.L   D2,D7           ; high word bits moving down
+    OR.L    D7,D3
+fsrjj:
+    TST.L   D4
+    BEQ     fsrjx
+    BSET    #0,D3
+fsrjx:
+    RTS
+fsrjb:
+    MOVEQ   #0,D2           ; all of it: just the sticky bit
+    MOVEQ   #1,D3
+    RTS
+
+* fcsh: A0:A1 = sigProd, D2:D3 = (sigC:0 >> D1.w) jammed
+fcsh:
+    MOVE.L  D2,A0
+    MOVE.L  D3,A1
+    MOVE.L  D6,D2
+    MOVEQ   #0,D3
+    BRA     fsrj
+
+* special operands
+fspec:
+    MOVE.L  D0,D4           ; NaN anywhere gives NaN
+    ADD.L   D4,D4
+    CMP.L   #$FF000000,D4
+    BHI     fnan
+    MOVE.L  D1,D4
+    ADD.L   D4,D4
+    CMP.L   #$FF000000,D4
+    BHI     fnan
+    MOVE.L  D6,D4
+    ADD.L   D4,D4
+    CMP.L   #$FF000000,D4
+    BHI     fnan
+    MOVE.L  D0,D4
+    ADD.L   D4,D4
+    CMP.L   #$FF000000,D4
+    BEQ     fpinf           ; a is inf
+    MOVE.L  D1,D4
+    ADD.L   D4,D4
+    CMP.L   #$FF000000,D4
+    BEQ     fpinf           ; b is inf
+    MOVE.L  D6,D0           ; product is finite: c is inf, or the
+    MOVE.L  D6,D4           ; product is 0 and c is the result
+    ADD.L   D4,D4
+    CMP.L   #$01000000,D4
+    BCC     ffin
+fzero:
+    MOVEQ   #0,D0
+    BRA     ffin
+fpinf:
+    MOVE.L  D0,D4           ; inf * 0 is invalid
+    ADD.L   D4,D4
+    CMP.L   #$01000000,D4
+    BCS     finv
+    MOVE.L  D1,D4
+    ADD.L   D4,D4
+    CMP.L   #$01000000,D4
+    BCS     finv
+    MOVE.L  D6,D4           ; so is inf - inf
+    ADD.L   D4,D4
+    CMP.L   #$FF000000,D4
+    BNE     finf
+    MOVE.L  D6,D4
+    EOR.L   D5,D4
+    BMI     finv
+    BRA     finf
+funf:
+    OR.W    #SPFUNF+SPFINX,_spfenv
+    BRA     fzero
+fovf:
+    OR.W    #SPFOVF+SPFINX,_spfenv
+finf:
+    MOVE.L  #$7F800000,D0
+    TST.L   D5
+    BPL     ffin
+    BSET    #31,D0
+    BRA     ffin
+finv:
+    OR.W    #SPFINV,_spfenv
+fnan:
+    MOVE.L  #$7FC00000,D0
+
+ffin:
+    MOVEM.L (A7)+,D2-D7
+    RTS
@@ -37,11 +37,41 @@ typedef struct {
         q2f  y;
 } CORDIC;
 
+// Phase oscillator (spfosi, spfosn): sin and cos of a, a + da,
+// a + 2 da, ... by turning a Q2.30 vector one step per sample.
+// The field order is fixed by spfosc.s.
+typedef struct {
+        q2f  c;         // cos and sin of the current angle
+        q2f  s;
+        q2f  cd;        // cos and sin of the step da
+        q2f  sd;
+        long n;         // samples to the next renormalization
+} SPFOSC;
+
+#define OSCRN   64L     // samples between renormalizations
+
 typedef struct {
         long hi;
         long lo;
 } q2d;
 
+// Unpacked extended value (spfspx.s) for chains of operations.
+// value = man * 2^(expo-31), man has its leading one in bit 31;
+// zero has man 0, inf/NaN have expo 0x4000 (NaN: man bit 30 set).
+typedef struct {
+        int  sign;      // 0 or -1
+        int  expo;      // unbiased exponent
+        long man;       // 32-bit mantissa
+} spx;
+
+// Sticky status flags (spfenv.s).  One word, raised with a single
+// OR to memory so interrupt handlers may call the library too.
+typedef struct {
+        int  flags;     // SPFINV | SPFDZ | SPFOVF | SPFUNF | SPFINX
+} SPFENV;
+
+extern SPFENV spfenv;
+
 // ——— Comparators (use with spfcmp) ————————————————————————————————
 #define spflt(a,b)  (spfcmp(a,b) <  0)
 #define spfgt(a,b)  (spfcmp(a,b) >  0)
@@ -54,7 +84,9 @@ typedef struct {
 spf spfadd();   // add
 spf spfmul();   // multiply
 spf spfsub();   // subtract
-spf spfdiv();   // divide
+spf spfdiv();   // divide; x/0 is NaN (SPFDZ)
+spf spfrcp();   // reciprocal, 1/x
+spf spffma();   // fused multiply-add, a*b+c rounded once
 spf spfmod();   // modulus
 
 // ——— Math support ————————————————————————————————————————————————
@@ -88,27 +120,64 @@ spf  q2d_fp();  // q2d -> spf
 // ——— Trig ————————————————————————————————————————————————————————————
 spf spfsin();   // sin
 spf spfcos();   // cos
+void spfscu();  // spfsc unchecked, a in [0, pi/4]: spfscu(a, &s, &c)
+spf spfsnu();   // sin unchecked, a in [0, pi/4]
+spf spfcsu();   // cos unchecked, a in [0, pi/4]
 spf spftan();   // tan
+void spfsc();   // sin and cos together: spfsc(a, &s, &c)
+void spfsct();  // spfsc to n CORDIC steps: spfsct(a, &s, &c, n)
+spf spfcot();   // cot
+spf spfsec();   // sec
+spf spfcsc();   // csc
 spf spfatn();   // atan
+spf spfatt();   // atan to n CORDIC steps: spfatt(a, n)
+spf spfasn();   // asin, double-iteration CORDIC
+spf spfacs();   // acos, double-iteration CORDIC
+void spfdsc();  // sin and cos of degrees: spfdsc(d, &s, &c)
+spf spfsnd();   // sin of degrees
+spf spfcsd();   // cos of degrees
+void spfpsc();  // sin and cos of pi x: spfpsc(x, &s, &c)
+spf spfspi();   // sinpi, sin(pi x)
+spf spfcpi();   // cospi, cos(pi x)
+void spfbsc();  // binary angle, 2^32 to a turn: spfbsc(b, &s, &c)
+void spvsc();   // arrays: spvsc(s, c, a, n), s or c may be 0
+void spvsin();  // r[i] = sin a[i]: spvsin(r, a, n)
+void spvcos();  // r[i] = cos a[i]
+void spfosi();  // start an oscillator: spfosi(&o, a, da)
+void spfosn();  // next sample: spfosn(&o, &s, &c) (spfosc.s)
+
+// CORDIC steps for spfsct and spfatt, chosen per call site.
+// Largest absolute error, sin/cos over [0, 2pi] and atan over
+// [-50, 50]; n steps leave about 2^(1-n):
+#define SPFTLO  12L     // 4.9e-4, 3 digits
+#define SPFTMD  18L     // 7.7e-6, 5 digits
+#define SPFTHI  26L     // full: spfsc and spfatn (2.5e-7)
 
 // ——— Euler ———————————————————————————————————————————————————————————
 spf spfexp();   // e^x
 spf spfln();    // ln
+spf spfexu();   // e^x unchecked, |x| <= 87
+spf spflnu();   // ln unchecked, x in [1, 2)
 spf spflog();   // log10
 spf spflg2();   // log2
 spf spfpow();   // x^y
+void spvexp();  // r[i] = e^a[i]: spvexp(r, a, n)
+void spvln();   // r[i] = ln a[i]: spvln(r, a, n)
 
 // ——— Hyperbolic ————————————————————————————————————————————————————
 void spfshc();  // compute sinh & cosh together
 spf  spfsnh();  // sinh
 spf  spfcoh();  // cosh
 spf  spftnh();  // tanh
+spf  spfexh();  // e^x by the hyperbolic CORDIC
 spf  asnh();    // asinh
 spf  acnh();    // acosh
 spf  atnh();    // atanh
 
 // ——— Other helpers ————————————————————————————————————————————————
-spf  spfa2();   // atan2-like from sin and cos
+spf  spfa2();   // atan2(y, x), from spfpol
+void spfpol();  // polar: spfpol(x, y, &r, &theta), one CORDIC pass
+void spfrot();  // rotate: spfrot(x, y, a, &xo, &yo), one CORDIC pass
 spf  spfhyp();  // hypot
 spf  spfmdf();  // modf: returns frac, int part via *arg2
 void spffxp();  // extract mantissa & exponent
@@ -116,6 +185,38 @@ spf  spfldp();  // compose from mantissa & exponent
 spf  spfcps();  // copysign(x,y)
 spf  spfscb();  // scalbn: x * 2^n
 
+// ——— Unpacked chains (spx) ————————————————————————————————————————
+void fpspx();   // spf -> spx
+spf  spx_fp();  // spx -> spf, rounded once to nearest-even
+void spxadd();  // r = a + b
+void spxsub();  // r = a - b
+void spxmul();  // r = a * b
+void spxdiv();  // r = a / b; a/0 is a signed inf (SPFDZ), not NaN as in spfdiv
+void spxfma();  // r = a * b + c
+
+// ——— Vectors (spfvec.s), n elements, r may be a or b ———————————————
+void spvadd();  // r[i] = a[i] + b[i]
+void spvsub();  // r[i] = a[i] - b[i]
+void spvmul();  // r[i] = a[i] * b[i]
+void spvscl();  // r[i] = a[i] * k
+spf  spvdot();  // sum of a[i] * b[i], rounded once
+spf  spvsum();  // sum of a[i], rounded once
+spf  spvmin();  // smallest a[i] (spfcmp order)
+spf  spvmax();  // largest a[i]
+long spvamx();  // index of the first largest a[i], -1 if n <= 0
+
+// ——— Status flags ————————————————————————————————————————————————
+long spftst();  // flags selected by mask that are set
+void spfclr();  // clear flags selected by mask
+#define spfrse(f)  (spfenv.flags |= (int)(f))  // raise flags (library use)
+
+#define SPFINV  0x0001L  // invalid: 0/0, inf/inf, inf*0
+#define SPFDZ   0x0002L  // divide by zero
+#define SPFOVF  0x0004L  // overflow, result is a signed infinity
+#define SPFUNF  0x0008L  // underflow, result flushed to +0
+#define SPFINX  0x0010L  // inexact, result was rounded
+#define SPFALL  0x001fL  // all of the above
+
 // ——— Constants (IEEE-754 single stored in 32-bit int) ———————————————
 #define spfone  0x3f800000L  // 1
 #define spftwo  0x40000000L  // 2
@@ -134,6 +235,7 @@ spf  spfscb();  // scalbn: x * 2^n
 #define spfnz   0x80000000L  // -0
 #define spfn1   0xbf800000L  // -1
 #define spfNAN  0x7fc00000L  // NaN
+#define SPFEXB  0x42c80000L  // 100: e^x, sinh, cosh past spf either way
 
 // Booleans
 #define true    0x00000001L
@@ -4,6 +4,24 @@
 * Date       : 20241030format compatable
 *              format compatable but not compliant 
 *              multiplication routine for CP/M-68K 
+*
+* Version3: 16x16 MULU partial products.
+*   The 24x24 mantissa product is built from four MULU
+*   partial products (hi*hi, hi*lo, lo*hi, lo*lo) with the
+*   mantissas split as 8-bit high / 16-bit low halves, then
+*   rounded once to nearest-even on the full 48-bit product.
+*   Exponent overflow returns a signed infinity, underflow
+*   (and a zero or denormal operand) returns +0, NaN or
+*   inf*0 returns spfNAN.  SPFOVF, SPFUNF, SPFINV and SPFINX
+*   are raised in spfenv.  Only D2-D5 are saved.  mentry is
+*   the register entry (a in D0, b in D1) for spfvec.s.
+*
+*   Cycle counts (68000, no wait states, JSR not included,
+*   from the MC68000 UM instruction timing tables):
+*                       Version2        Version3
+*     normal operands   2636-2920       738-850
+*       average         2780            791
+*     zero operand      284-326         228-240
 *-----------------------------------------------------------
 **********************************************************/
 * Copyright 2025 John J Lovrinic                         */
@@ -32,107 +50,161 @@
 * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
 **********************************************************/
     .globl      _spfmul
-    
-_spfmul:
-* Version2: Shift and Add Based Solution for IEEE-754 Multiplication with 25th-bit rounding
+    .globl      mentry
+    .globl      _spfenv
+
+* sticky status flags, as in spflib.h
+SPFINV  .equ    $0001
+SPFOVF  .equ    $0004
+SPFUNF  .equ    $0008
+SPFINX  .equ    $0010
 
+_spfmul:
 *   load ops from stack(A7), starting at +4 and then +8 (0 must not be touched!)
     MOVE.L  4(A7),D0
     MOVE.L  8(A7),D1
-*   save other registers
-    MOVEM.L D2-D7/A0-A5,-(A7)
-* check for zero operand
-    CMP.L   #0,D0
-    BEQ     mfin
-    CMP.L   #0,D1
-    BNE     mcalc
-    MOVE.L  D1,D0
-    BRA     mfin
-mcalc:
-* Step 1: Clear result register pair (D6:D7)
-    CLR.L   D6
-    CLR.L   D7
+mentry:
+*   save working registers (D0/D1 are scratch)
+    MOVEM.L D2-D5,-(A7)
 
-* Step 2: Prepare operands and loop counter
-    MOVE.L  D0, D2
-    MOVE.L  D1, D3
-    AND.L   #$007FFFFF, D2
-    AND.L   #$007FFFFF, D3
-    OR.L    #$00800000, D2
-    OR.L    #$00800000, D3
-    MOVE.L  #23, D4
-    MOVE.L  #0, D5          ; D5 will hold bias
+* Step 1: sign into bit 31 of D5, high words of the operands into D2/D3
+    MOVE.L  D0,D5
+    EOR.L   D1,D5
+    MOVE.L  D0,D2
+    SWAP    D2
+    MOVE.L  D1,D3
+    SWAP    D3
 
-* Step 3: Shift-and-Add Loop
-shift_add_loop:
-    ASL.L   #1, D7
-    ROXL.L  #1, D6
-    BTST    #23, D3
-    BEQ     no_addition
-    ADD.L   D2, D7
-    ADDX.L  D5, D6
-no_addition:
-    ASL.L   #1, D3
-    DBRA    D4, shift_add_loop
+* Step 2: exponents, kept pre-shifted as (e << 7) in the low word of D5
+    MOVE.W  D2,D5
+    AND.W   #$7F80,D5
+    BEQ     mzera           ; a is zero (or denormal)
+    CMP.W   #$7F80,D5
+    BEQ     mspec           ; a is inf/NaN
+    MOVE.W  D3,D4
+    AND.W   #$7F80,D4
+    BEQ     mzerb           ; b is zero (or denormal)
+    CMP.W   #$7F80,D4
+    BEQ     mspec           ; b is inf/NaN
+    ADD.W   D4,D5           ; (ea + eb) << 7, unsigned
 
-* Step 4: Shift result left by 8 bits (bit-by-bit, corrected)
-    MOVEQ   #7, D4          ; Loop exactly 8 times
-shift_left_loop:
-    ASL.L   #1, D7
-    ROXL.L  #1, D6
-    DBRA    D4, shift_left_loop
+* Step 3: high mantissa bytes with the hidden bit restored
+    AND.W   #$007F,D2
+    OR.W    #$0080,D2       ; D2 = ah (8 bits)
+    AND.W   #$007F,D3
+    OR.W    #$0080,D3       ; D3 = bh (8 bits)
 
-* Step 5: Normalize based on bit 23 of D6 (optimized)
-    MOVE.L  #1, D5          ; Assume bias = 1
-    BTST    #23, D6
-    BNE     round           ; If bit 23 is set, skip shift
+* Step 4: partial products (the short high bytes are the MULU sources)
+    MOVE.W  D3,D4
+    MULU    D2,D4           ; D4 = ah*bh
+    MULU    D1,D2           ; D2 = ah*bl
+    MULU    D0,D3           ; D3 = al*bh
+    MULU    D1,D0           ; D0 = al*bl
+    ADD.L   D3,D2           ; D2 = cross terms (< 2^25)
 
-    ASL.L   #1, D7
-    ROXL.L  #1, D6
-    MOVE.L  #0, D5          ; Correct bias to 0
+* Step 5: 48-bit product in D4:D0 = (ah*bh << 32) + (cross << 16) + al*bl
+    SWAP    D2
+    MOVEQ   #0,D3
+    MOVE.W  D2,D3           ; D3 = cross >> 16
+    CLR.W   D2              ; D2 = cross << 16
+    ADD.L   D2,D0
+    ADDX.L  D3,D4
 
-* Step 6: Rounding (round-to-nearest-even)
-round:
-    BTST    #31, D7
-    BEQ     round_done
-    BTST    #0, D6
-    BNE     round_done
-    ADDQ.L  #1, D6
-round_done:
+* Step 6: top 24 bits into D4, remaining 24 bits left-justified in D0
+    LSL.L   #8,D4
+    ROL.L   #8,D0
+    MOVE.B  D0,D4
+    CLR.B   D0
+    BTST    #23,D4
+    BEQ     mshift
+    ADD.W   #$0080,D5       ; product >= 2: exponent + 1
+    BRA     mround
+mshift:
+    ADD.L   D0,D0           ; product < 2: one more bit from D0
+    ADDX.L  D4,D4
 
-* Step 7: Exponent Calculation
-continue_exponent:
-    MOVE.L  D0, D2
-    MOVE.L  D1, D3
-    AND.L   #$7F800000, D2
-    AND.L   #$7F800000, D3
-    MOVE.L  #23, D4
-    LSR.L   D4, D2
-    LSR.L   D4, D3
-    SUB.L   #127, D2
-    SUB.L   #127, D3
-    ADD.L   D2, D3
-    ADD.L   D5, D3
-    ADD.L   #127, D3
+* Step 7: round to nearest even on round bit (D0 bit 31) and sticky bits
+mround:
+    ADD.L   D0,D0
+    BCS     mhalf
+    BEQ     mexp            ; exact
+    BRA     minex           ; round bit clear
+mhalf:
+    BNE     mrndup          ; sticky bits set: round up
+    BTST    #0,D4
+    BEQ     minex           ; tie and already even
+mrndup:
+    ADDQ.L  #1,D4           ; a carry to 2^24 bumps the exponent when packed
+    BTST    #24,D4
+    BEQ     minex
+    CMP.W   #$BE80,D5
+    BNE     minex
+    OR.W    #SPFOVF,_spfenv ; rounded up to infinity
+minex:
+    OR.W    #SPFINX,_spfenv
 
-    MOVE.L  #23, D4
-    LSL.L   D4, D3
-    MOVE.L  D3, D4
+* Step 8: remove bias - (e-1) << 7 must lie in 0..253 << 7
+mexp:
+    SUB.W   #$4000,D5       ; (ea + eb - 127 - 1) << 7
+    BCS     munf            ; underflow
+    CMP.W   #$7E80,D5
+    BHI     movf            ; overflow
 
-* Step 8: Sign Calculation
-    MOVE.L  D0, D2
-    MOVE.L  D1, D3
-    EOR.L   D2, D3
-    AND.L   #$80000000, D3
-    MOVE.L  D3, D5
+* Step 9: assemble final result (hidden bit carries (e-1) up to e)
+    MOVE.W  D5,D0
+    SWAP    D0
+    CLR.W   D0
+    ADD.L   D4,D0
+    TST.L   D5
+    BPL     mfin
+    BSET    #31,D0
+    BRA     mfin
 
-* Step 9: Assemble final result
-    AND.L   #$007FFFFF, D6
-    OR.L    D4, D6
-    OR.L    D5, D6
-    MOVE.L  D6, D0
+* special operands
+mzera:
+    MOVE.W  D3,D4           ; a is zero: inf/NaN * 0 is NaN
+    AND.W   #$7F80,D4
+    CMP.W   #$7F80,D4
+    BNE     mzero
+    MOVE.L  D1,D3
+    ADD.L   D3,D3
+    CMP.L   #$FF000000,D3
+    BHI     mnan            ; 0 * NaN
+    BRA     minv            ; 0 * inf
+mzerb:
+mzero:
+    MOVEQ   #0,D0
+    BRA     mfin
+mspec:
+    MOVE.L  D0,D2           ; NaN in, or inf * 0, gives NaN
+    ADD.L   D2,D2
+    CMP.L   #$FF000000,D2
+    BHI     mnan
+    CMP.L   #$01000000,D2
+    BCS     minv
+    MOVE.L  D1,D3
+    ADD.L   D3,D3
+    CMP.L   #$FF000000,D3
+    BHI     mnan
+    CMP.L   #$01000000,D3
+    BCS     minv
+    BRA     minf
+munf:
+    OR.W    #SPFUNF+SPFINX,_spfenv
+    BRA     mzero
+movf:
+    OR.W    #SPFOVF+SPFINX,_spfenv
+minf:
+    MOVE.L  #$7F800000,D0
+    TST.L   D5
+    BPL     mfin
+    BSET    #31,D0
+    BRA     mfin
+minv:
+    OR.W    #SPFINV,_spfenv ; inf * 0
+mnan:
+    MOVE.L  #$7FC00000,D0
 
 mfin:
-    MOVEM.L (A7)+,D2-D7/A0-A5
+    MOVEM.L (A7)+,D2-D5
     RTS
-
@@ -0,0 +1,217 @@
+*-----------------------------------------------------------
+* Title      : spfosc.s
+* Written by : J. Lovrinic
+* Date       : 20261017
+*              phase oscillator step: spfosn
+*
+*   spfosn(&o, &s, &c) hands out sin and cos of the current
+*   angle of an SPFOSC (spflib.h) set up by spfosi, then
+*   turns the Q2.30 vector (c, s) on by the step da:
+*     c' = c cd - s sd
+*     s' = s cd + c sd
+*   Each product is one signed Q2.30 multiply (oqmul: four
+*   MULU, rounded to nearest); each output is packed from
+*   Q2.30 to spf with one rounding to nearest-even (opack).
+*   Every OSCRN samples the length of (c, s) is pulled back
+*   to 1 by g = (3 - c^2 - s^2) / 2, which keeps rounding
+*   from growing or shrinking the waveform.
+*
+*   The amplitude stays within 1e-7 of 1.  The phase is off
+*   by the rounding of cd and sd to Q2.30, about n * 2^-31
+*   after n samples (1e-5 at 20000); call spfosi again to
+*   start afresh from spfsc.
+*
+*   Cycle counts (68000, no wait states, JSR not included,
+*   simulator):
+*     spfosn            2746-3080
+*       every OSCRN-th  4600-5046
+*       average         about 2900
+*     spfsc (cord8)     q2rot alone 10846-10906
+*   A component near 0 adds up to 15 normalizing shifts.
+*-----------------------------------------------------------
+**********************************************************/
+* Copyright 2025 John J Lovrinic                         */
+* Permission is hereby granted, free of charge,          */     
+* to any person obtaining a copy of this software        */
+* and associated documentation files (the “Software”),   */
+* to deal in the Software without restriction,           */
+* including without limitation the rights to use,        */
+* copy, modify, merge, publish, distribute, sublicense,  */
+* and/or sell copies of the Software, and to permit      */
+* persons to whom the Software is furnished to do so,    */
+* subject to the following conditions:                   */
+*                                                        */
+* The above copyright notice and this permission notice  */
+* shall be included in all copies or substantial         */
+* portions of the Software.                              */
+*                                                        */
+* THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY     */
+* OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT     */
+* LIMITED TO THE WARRANTIES OF MERCHANTABILITY,          */
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  */
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS     */
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,   */
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,   */
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE         */
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+**********************************************************/
+    .globl      _spfosn
+
+OSCRN   .equ    64              ; samples between renormalizations
+
+* SPFOSC field offsets, as in spflib.h
+OC      .equ    0
+OS      .equ    4
+OCD     .equ    8
+OSD     .equ    12
+ON      .equ    16
+
+_spfosn:
+    MOVEM.L D2-D7/A2,-(A7)
+    MOVE.L  32(A7),A2       ; o
+    MOVE.L  OS(A2),D0
+    BSR     opack
+    MOVE.L  36(A7),A0
+    MOVE.L  D0,(A0)         ; *sp
+    MOVE.L  OC(A2),D0
+    BSR     opack
+    MOVE.L  40(A7),A0
+    MOVE.L  D0,(A0)         ; *cp
+
+* rotate by the step
+    MOVE.L  OC(A2),D0
+    MOVE.L  OCD(A2),D1
+    BSR     oqmul
+    MOVE.L  D0,D5           ; c cd
+    MOVE.L  OS(A2),D0
+    MOVE.L  OSD(A2),D1
+    BSR     oqmul
+    SUB.L   D0,D5           ; c'
+    MOVE.L  OS(A2),D0
+    MOVE.L  OCD(A2),D1
+    BSR     oqmul
+    MOVE.L  D0,D6           ; s cd
+    MOVE.L  OC(A2),D0
+    MOVE.L  OSD(A2),D1
+    BSR     oqmul
+    ADD.L   D0,D6           ; s'
+    SUBQ.L  #1,ON(A2)
+    BNE     osnst
+
+* renormalize: scale by g = (3 - c^2 - s^2) / 2
+    MOVE.L  D5,D0
+    MOVE.L  D5,D1
+    BSR     oqmul
+    MOVE.L  D0,D7
+    MOVE.L  D6,D0
+    MOVE.L  D6,D1
+    BSR     oqmul
+    ADD.L   D0,D7           ; c^2 + s^2, close to 1
+    MOVE.L  #$C0000000,D0   ; 3 in Q2.30, unsigned
+    SUB.L   D7,D0
+    LSR.L   #1,D0
+    MOVE.L  D0,D7           ; g
+    MOVE.L  D5,D1
+    BSR     oqmul
+    MOVE.L  D0,D5
+    MOVE.L  D7,D0
+    MOVE.L  D6,D1
+    BSR     oqmul
+    MOVE.L  D0,D6
+    MOVE.L  #OSCRN,ON(A2)
+osnst:
+    MOVE.L  D5,OC(A2)
+    MOVE.L  D6,OS(A2)
+    MOVEM.L (A7)+,D2-D7/A2
+    RTS
+
+* oqmul: D0 = D0 * D1 in Q2.30, rounded to nearest (ties
+* away from zero); the product must fit Q2.30.  D2-D4 and
+* A1 are scratch.
+oqmul:
+    MOVE.L  D0,D4
+    EOR.L   D1,D4
+    MOVE.L  D4,A1           ; sign of the product in bit 31
+    TST.L   D0
+    BPL     oqm1
+    NEG.L   D0
+oqm1:
+    TST.L   D1
+    BPL     oqm2
+    NEG.L   D1
+oqm2:
+    MOVE.L  D0,D2
+    SWAP    D2              ; D2 = ah
+    MOVE.L  D1,D3
+    SWAP    D3              ; D3 = bh
+    MOVE.W  D3,D4
+    MULU    D2,D4           ; D4 = ah*bh
+    MULU    D1,D2           ; D2 = ah*bl
+    MULU    D0,D3           ; D3 = al*bh
+    MULU    D1,D0           ; D0 = al*bl
+    MOVEQ   #0,D1
+    ADD.L   D3,D2
+    ADDX.L  D1,D1           ; carry out of the cross terms
+    SWAP    D2
+    SWAP    D1
+    MOVE.W  D2,D1           ; D1 = cross >> 16
+    CLR.W   D2              ; D2 = cross << 16
+    ADD.L   D2,D0
+    ADDX.L  D1,D4           ; 64-bit product in D4:D0
+    MOVEQ   #0,D1
+    ADD.L   #$20000000,D0   ; half of bit 30
+    ADDX.L  D1,D4
+    LSL.L   #2,D4
+    ROL.L   #2,D0
+    AND.L   #3,D0
+    OR.L    D4,D0           ; product >> 30
+    MOVE.L  A1,D4
+    TST.L   D4
+    BPL     oqm3
+    NEG.L   D0
+oqm3:
+    RTS
+
+* opack: D0 = Q2.30 in D0 as spf, rounded to nearest-even.
+* D1-D3 are scratch.
+opack:
+    MOVE.L  D0,D1           ; sign
+    BEQ     opkz
+    BPL     opk1
+    NEG.L   D0
+opk1:
+    MOVE.W  #128,D2         ; biased exponent with bit 31 set
+    CMP.L   #$00010000,D0
+    BCC     opk2
+    SWAP    D0
+    SUB.W   #16,D2
+opk2:
+    TST.L   D0
+    BMI     opk3
+opk2a:
+    SUBQ.W  #1,D2
+    ADD.L   D0,D0
+    BPL     opk2a
+opk3:
+    MOVE.L  D0,D3
+    LSR.L   #8,D3           ; 24-bit mantissa
+    CMP.B   #$80,D0
+    BCS     opk4            ; below half
+    BHI     opk3a
+    BTST    #0,D3
+    BEQ     opk4            ; tie and already even
+opk3a:
+    ADDQ.L  #1,D3           ; a carry to 2^24 bumps the exponent
+opk4:
+    SUBQ.W  #1,D2
+    SWAP    D2
+    CLR.W   D2
+    LSL.L   #7,D2           ; (e - 1) << 23
+    ADD.L   D3,D2           ; hidden bit carries (e - 1) up to e
+    TST.L   D1
+    BPL     opk5
+    BSET    #31,D2
+opk5:
+    MOVE.L  D2,D0
+opkz:
+    RTS
@@ -0,0 +1,297 @@
+*-----------------------------------------------------------
+* Title      : spfred.s
+* Written by : J. Lovrinic
+* Date       : 20261017
+*              trig argument reduction: octred
+*
+*   octred(a, &oct) returns the angle reduced to [0, pi/4]
+*   and stores the octant 0..7 of a in [0, 2pi), as spfsin,
+*   spfcos and spftan (spft1.c) expect: odd octants give
+*   the distance to the next multiple of pi/4.
+*
+*   Payne-Hanek in one pass, no loop over 2pi:  a = m * 2^E
+*   is multiplied by the 96 bits of 4/pi (fopi, spftbl.s)
+*   that lie between 2^(2-E) and 2^(-93-E).  Higher bits
+*   only add multiples of 8 octants and lower bits stay
+*   under 2^-69, so the low 96 bits of the product hold the
+*   octant (top 3 bits) and its fraction.  Over every spf
+*   input the fraction has at most 28 leading zeros, which
+*   leaves 40 good bits.  The fraction is normalized, scaled
+*   by pi/4 and rounded to nearest.
+*   |a| < pi/4 is returned as is (octant 7 for a < 0);
+*   inf and NaN give spfNAN and octant 8, inf raises SPFINV.
+*
+*   Cycle counts (68000, no wait states, JSR not included,
+*   simulator, 50 arguments per row).  The old C octred ran
+*   a tail of spfdiv, spfmul, spfint, spflng and spfsub plus
+*   about 950 cycles (spfsub 727, spfcmp 98, two calls) for
+*   every 2pi it took off:
+*                       octred          old octred
+*     |a| < pi/4        126             tail
+*     1 .. 6            2068-2324       tail
+*     10 .. 100         2070-2428       tail + up to 15k
+*     1e4               2070-2300       tail + 1.5M
+*     1e10 .. 3e38      2034-2478       never ends (a - 2pi == a)
+*-----------------------------------------------------------
+**********************************************************/
+* Copyright 2025 John J Lovrinic                         */
+* Permission is hereby granted, free of charge,          */     
+* to any person obtaining a copy of this software        */
+* and associated documentation files (the “Software”),   */
+* to deal in the Software without restriction,           */
+* including without limitation the rights to use,        */
+* copy, modify, merge, publish, distribute, sublicense,  */
+* and/or sell copies of the Software, and to permit      */
+* persons to whom the Software is furnished to do so,    */
+* subject to the following conditions:                   */
+*                                                        */
+* The above copyright notice and this permission notice  */
+* shall be included in all copies or substantial         */
+* portions of the Software.                              */
+*                                                        */
+* THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY     */
+* OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT     */
+* LIMITED TO THE WARRANTIES OF MERCHANTABILITY,          */
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  */
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS     */
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,   */
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,   */
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE         */
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+**********************************************************/
+    .globl      _octred
+    .globl      _fopi
+    .globl      _spfenv
+
+SPFINV  .equ    $0001
+
+_octred:
+    MOVE.L  4(A7),D0
+    MOVE.L  D0,D1
+    BCLR    #31,D1          ; D1 = |a|
+    CMP.L   #$3F490FDB,D1
+    BCS     rsmall          ; |a| < pi/4
+    CMP.L   #$7F800000,D1
+    BCC     rspec           ; inf or NaN
+    MOVEM.L D2-D7,-(A7)
+
+* Step 1: 96-bit window of 4/pi starting at bit e - 152 (table bit e - 120)
+    MOVE.L  D1,D2
+    SWAP    D2
+    LSR.W   #7,D2           ; D2 = biased exponent e (126..254)
+    SUB.W   #120,D2
+    MOVE.W  D2,D3
+    LSR.W   #5,D3
+    LSL.W   #2,D3           ; byte offset of the first long
+    AND.W   #31,D2          ; bit shift within it
+    LEA     _fopi,A0
+    ADDA.W  D3,A0
+    MOVEM.L (A0),D4-D7
+    MOVEQ   #32,D3
+    SUB.W   D2,D3           ; 32 - shift (a shift of 32 gives 0)
+    LSL.L   D2,D4
+    MOVE.L  D5,D0
+    LSR.L   D3,D0
+    OR.L    D0,D4
+    LSL.L   D2,D5
+    MOVE.L  D6,D0
+    LSR.L   D3,D0
+    OR.L    D0,D5
+    LSL.L   D2,D6
+    LSR.L   D3,D7
+    OR.L    D7,D6           ; window in D4:D5:D6
+
+* Step 2: mantissa m = mh:ml (8:16 bits)
+    AND.L   #$007FFFFF,D1
+    BSET    #23,D1          ; D1.W = ml
+    MOVE.L  D1,D7
+    SWAP    D7              ; D7.W = mh
+
+* Step 3: D4:D5:D6 = low 96 bits of window * m, one word at a time
+*   w * m = A + (B << 16) with A = w * ml, B = w * mh; the low
+*   word of A plus the carry is the result word, the rest
+*   carries on.  Results replace the window words in place.
+    MOVEQ   #0,D2           ; carry
+    MOVE.W  D6,D0           ; word 0
+    MULU    D1,D0
+    MOVE.W  D6,D3
+    MULU    D7,D3
+    ADD.W   D0,D2
+    MOVE.W  D2,D6
+    CLR.W   D2
+    SWAP    D2
+    CLR.W   D0
+    SWAP    D0
+    ADDX.L  D0,D2
+    ADD.L   D3,D2
+    SWAP    D6              ; word 1
+    MOVE.W  D6,D0
+    MULU    D1,D0
+    MOVE.W  D6,D3
+    MULU    D7,D3
+    ADD.W   D0,D2
+    MOVE.W  D2,D6
+    CLR.W   D2
+    SWAP    D2
+    CLR.W   D0
+    SWAP    D0
+    ADDX.L  D0,D2
+    ADD.L   D3,D2
+    SWAP    D6
+    MOVE.W  D5,D0           ; word 2
+    MULU    D1,D0
+    MOVE.W  D5,D3
+    MULU    D7,D3
+    ADD.W   D0,D2
+    MOVE.W  D2,D5
+    CLR.W   D2
+    SWAP    D2
+    CLR.W   D0
+    SWAP    D0
+    ADDX.L  D0,D2
+    ADD.L   D3,D2
+    SWAP    D5              ; word 3
+    MOVE.W  D5,D0
+    MULU    D1,D0
+    MOVE.W  D5,D3
+    MULU    D7,D3
+    ADD.W   D0,D2
+    MOVE.W  D2,D5
+    CLR.W   D2
+    SWAP    D2
+    CLR.W   D0
+    SWAP    D0
+    ADDX.L  D0,D2
+    ADD.L   D3,D2
+    SWAP    D5
+    MOVE.W  D4,D0           ; word 4
+    MULU    D1,D0
+    MOVE.W  D4,D3
+    MULU    D7,D3
+    ADD.W   D0,D2
+    MOVE.W  D2,D4
+    CLR.W   D2
+    SWAP    D2
+    CLR.W   D0
+    SWAP    D0
+    ADDX.L  D0,D2
+    ADD.L   D3,D2
+    SWAP    D4              ; word 5, only its low 16 bits are kept
+    MOVE.W  D4,D0
+    MULU    D1,D0
+    ADD.W   D2,D0
+    MOVE.W  D0,D4
+    SWAP    D4
+
+* Step 4: octant = top 3 bits, fraction left-justified in D4:D5:D6
+    MOVEQ   #0,D3
+    MOVEQ   #2,D0
+rocl:
+    ADD.L   D6,D6
+    ADDX.L  D5,D5
+    ADDX.L  D4,D4
+    ADDX.L  D3,D3
+    DBRA    D0,rocl
+    BTST    #0,D3
+    BEQ     rnorm
+    NEG.L   D6              ; odd octant: distance to the next pi/4
+    NEGX.L  D5
+    NEGX.L  D4
+
+* Step 5: normalize the fraction, D2 = leading zeros
+rnorm:
+    MOVEQ   #0,D2
+    TST.L   D4
+    BNE     rnrm16
+    MOVE.L  D5,D4           ; not reached for spf inputs; kept for safety
+    MOVE.L  D6,D5
+    MOVEQ   #32,D2
+    TST.L   D4
+    BEQ     rzero
+rnrm16:
+    CMP.L   #$00010000,D4
+    BCC     rnrm1
+    SWAP    D4              ; shift 16
+    SWAP    D5
+    MOVE.W  D5,D4
+    CLR.W   D5
+    ADD.W   #16,D2
+    BRA     rnrm1
+rnrml:
+    ADD.L   D5,D5
+    ADDX.L  D4,D4
+    ADDQ.W  #1,D2
+rnrm1:
+    TST.L   D4
+    BPL     rnrml
+
+* Step 6: top 32 bits of fraction * pi/4 (pi/4 * 2^32 = $C90FDAA2)
+    MOVE.L  D4,D1
+    SWAP    D1
+    MOVE.W  D1,D6
+    MULU    #$C90F,D1       ; nh * ch
+    MULU    #$DAA2,D6       ; nh * cl
+    MULU    #$C90F,D4       ; nl * ch
+    ADD.L   D6,D4
+    MOVEQ   #0,D6
+    ADDX.W  D6,D6
+    SWAP    D6
+    CLR.W   D4
+    SWAP    D4
+    ADD.L   D6,D4
+    ADD.L   D4,D1           ; D1 = scaled fraction, bit 31 or 30 leading
+    BMI     rrnd
+    ADD.L   D1,D1
+    ADDQ.W  #1,D2
+
+* Step 7: round to 24 bits and pack, exponent 126 - leading zeros
+rrnd:
+    ADD.L   #$80,D1
+    BCC     rpack
+    ROXR.L  #1,D1           ; rounded up to 2.0
+    SUBQ.W  #1,D2
+rpack:
+    LSR.L   #8,D1
+    MOVE.W  #125,D0         ; hidden bit adds the last 1
+    SUB.W   D2,D0
+    SWAP    D0
+    CLR.W   D0
+    LSL.L   #7,D0
+    ADD.L   D1,D0
+rsto:
+    MOVE.L  4+24(A7),D1     ; restore the sign of a into the octant
+    BPL     rsto1
+    EOR.W   #7,D3
+rsto1:
+    MOVE.L  8+24(A7),A0
+    MOVE.L  D3,(A0)
+    MOVEM.L (A7)+,D2-D7
+    RTS
+rzero:
+    MOVEQ   #0,D0
+    BRA     rsto
+
+* |a| < pi/4: no reduction, octant 0, or 7 for a < 0
+rsmall:
+    MOVE.L  8(A7),A0
+    TST.L   D0
+    BMI     rsneg
+    CLR.L   (A0)
+    RTS
+rsneg:
+    MOVE.L  D1,D0
+    MOVEQ   #7,D1
+    MOVE.L  D1,(A0)
+    RTS
+
+* inf/NaN: spfNAN and octant 8 (octmap gives NaN)
+rspec:
+    CMP.L   #$7F800000,D1
+    BNE     rspnan
+    OR.W    #SPFINV,_spfenv
+rspnan:
+    MOVE.L  #$7FC00000,D0
+    MOVE.L  8(A7),A0
+    MOVEQ   #8,D1
+    MOVE.L  D1,(A0)
+    RTS
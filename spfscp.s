@@ -0,0 +1,547 @@
+*-----------------------------------------------------------
+* Title      : spfscp.s
+* Written by : J. Lovrinic
+* Date       : 20261017
+*              table and polynomial kernels: scpoly (sin/cos)
+*              and atpoly (atan)
+*
+*   scpoly(r, &s, &c) gives sin r and cos r for r in
+*   [0, pi/4] from octred, in place of cord8 when spft1.c is
+*   built with SCPOLY.  r = k/32 + d with k = 1..25 the
+*   nearest breakpoint and |d| <= 1/64; sin and cos of k/32
+*   come from sctb (spftbl.s, Q0.32) and
+*     sin d = d - d^3/6                 (error < 2^-36)
+*     cos d = 1 - d^2/2 + d^4/24        (error < 2^-42)
+*     sin r = S + C sin d - S (1 - cos d)
+*     cos r = C - S sin d - C (1 - cos d)
+*   in unsigned fixed point: d scaled by 2^37, d^2 by 2^42,
+*   32x32 products by four MULU (umh), the sums in 64 bits.
+*   Each result is rounded once to nearest-even.
+*   Below 2^-6, sin r = r (1 - r^2/6) and
+*   cos r = 1 - r^2/2 + r^4/24 relative to r; below 2^-12
+*   they round to r and 1.  NaN in gives NaN out.
+*
+*   Against the CORDIC engine (cord8: fpq2d, q2rot, two
+*   q2d_fp), simulator and host sweeps of 4000-6000 angles:
+*                       scpoly          cord8
+*     cycles (68000, no wait states, JSR not included)
+*     r in [2^-6, pi/4] 4094-4696       q2rot alone 10846-10906
+*     r in [2^-12,2^-6) 2478-2680
+*     r < 2^-12         322
+*     max error, ulp against double sin/cos
+*     sin [2^-6, pi/4]  0.54            16.7
+*     sin [2^-12,2^-6)  0.50            1037
+*     sin < 2^-12       0.16            3e8 (Q2.30 result)
+*     cos               0.50            1.27
+*     bytes             552 + sctb 200  q2rot 374 + crdmsk 64
+*                                       + atntb 256 + C cord8,
+*                                       fpq2d, q2d_fp
+*   scbench.c times the two engines on the target.
+*
+*   atpoly(a) gives atan a for a >= 0, in place of the CORDIC
+*   spfatt when spft2.c is built with ATPOLY.  With b = k/16
+*   the breakpoint nearest a (a < 1) or nearest 1/a (a >= 1)
+*     t = (a - b) / (1 + ab)    atan a = atan b + atan t
+*     t = (1 - ab) / (a + b)    atan a = pi/2 - atan b - atan t
+*   so a >= 1 costs the same one divide (32 shift-subtract
+*   steps) as a < 1, not a 1/a first.  |t| <= 1/32 and
+*     atan t = t - t^3/3 + t^5/5    (error < 2^-37)
+*   with t scaled by 2^36, atan b from attb (spftbl.s, Q2.62)
+*   and the sum rounded once.  Below 2^-5, a (1 - a^2/3 +
+*   a^4/5) relative to a; below 2^-12, a; from 2^26, pi/2.
+*   NaN in gives NaN out.
+*                       atpoly          spfatt(a, SPFTHI)
+*     cycles
+*     a in [2^-5, 1)    5034-5666       q1vecd alone 6620-6962
+*     a in [1, 64)      5374-5938       + spfdiv for a >= 1
+*     a in [64, 2^26)   4760-5500
+*     a in [2^-12,2^-5) 2244-2414
+*     max error, ulp    0.51            32.7
+*     bytes             536 + attb 128  q1vecd + atntb 256
+*                                       + C spfatt, q2d_fp
+*   atnbench.c times the two on the target.
+*-----------------------------------------------------------
+**********************************************************/
+* Copyright 2025 John J Lovrinic                         */
+* Permission is hereby granted, free of charge,          */     
+* to any person obtaining a copy of this software        */
+* and associated documentation files (the “Software”),   */
+* to deal in the Software without restriction,           */
+* including without limitation the rights to use,        */
+* copy, modify, merge, publish, distribute, sublicense,  */
+* and/or sell copies of the Software, and to permit      */
+* persons to whom the Software is furnished to do so,    */
+* subject to the following conditions:                   */
+*                                                        */
+* The above copyright notice and this permission notice  */
+* shall be included in all copies or substantial         */
+* portions of the Software.                              */
+*                                                        */
+* THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY     */
+* OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT     */
+* LIMITED TO THE WARRANTIES OF MERCHANTABILITY,          */
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  */
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS     */
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,   */
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,   */
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE         */
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+**********************************************************/
+    .globl      _scpoly
+    .globl      _sctb
+    .globl      _atpoly
+    .globl      _attb
+    .globl      _q2pi2
+
+K6      .equ    $2AAAAAAB       ; 2^32 / 6, rounded up
+K3      .equ    $55555555       ; 2^32 / 3
+K5      .equ    $33333333       ; 2^32 / 5
+
+_scpoly:
+    MOVEM.L D2-D7/A2-A3,-(A7)
+    MOVE.L  36(A7),D0       ; r
+    MOVE.L  D0,D1
+    SWAP    D1
+    LSR.W   #7,D1           ; biased exponent (r >= 0)
+    CMP.W   #121,D1
+    BCS     psmall          ; r < 2^-6
+    CMP.W   #127,D1
+    BCC     pnan            ; only NaN gets here
+
+* Step 1: R = r in Q0.32, k = nearest breakpoint, |d| scaled by 2^37
+    AND.L   #$007FFFFF,D0
+    BSET    #23,D0
+    SUB.W   #118,D1
+    LSL.L   D1,D0           ; R
+    MOVE.L  D0,D1
+    ADD.L   #$04000000,D1
+    ROL.L   #5,D1
+    AND.L   #$0000001F,D1   ; k = 1..25
+    MOVE.L  D1,D2
+    ROR.L   #5,D2
+    SUB.L   D2,D0           ; d = R - k/32
+    SMI     D7              ; sign of d
+    BPL     ppos
+    NEG.L   D0
+ppos:
+    LSL.L   #5,D0           ; A = |d| * 2^37
+    MOVE.L  D0,D6
+    LEA     _sctb-8,A2
+    LSL.W   #3,D1
+    ADDA.W  D1,A2           ; (A2) = sin k/32, 4(A2) = cos k/32
+
+* Step 2: sin |d| and 1 - cos d
+    MOVE.L  D6,D1
+    BSR     umh
+    MOVE.L  D0,D5           ; d^2 * 2^42
+    MOVE.L  #K6,D1
+    BSR     umh
+    MOVE.L  D0,A1           ; d^2/6 * 2^42
+    MOVE.L  D6,D1
+    BSR     umh
+    MOVEQ   #10,D1
+    LSR.L   D1,D0
+    SUB.L   D0,D6           ; sin |d| * 2^37
+    MOVE.L  D5,D0
+    MOVE.L  A1,D1
+    BSR     umh
+    MOVEQ   #12,D1
+    LSR.L   D1,D0           ; d^4/24 * 2^42
+    LSR.L   #1,D5
+    SUB.L   D0,D5
+    MOVE.L  D5,A3           ; (1 - cos d) * 2^42
+
+* Step 3: sin r = S + sgn C sin|d| - S (1 - cos d)
+    MOVE.L  4(A2),D0
+    MOVE.L  D6,D1
+    BSR     umh
+    MOVE.L  D0,D5           ; C sin|d| * 2^37
+    MOVE.L  (A2),D0
+    MOVE.L  A3,D1
+    BSR     umh             ; S (1 - cos d) * 2^42
+    TST.B   D7
+    BSR     pcomb
+    ADD.L   (A2),D0
+    BSR     pack
+    MOVE.L  40(A7),A0
+    MOVE.L  D0,(A0)
+
+* Step 4: cos r = C - sgn S sin|d| - C (1 - cos d)
+    MOVE.L  (A2),D0
+    MOVE.L  D6,D1
+    BSR     umh
+    MOVE.L  D0,D5           ; S sin|d| * 2^37
+    MOVE.L  4(A2),D0
+    MOVE.L  A3,D1
+    BSR     umh             ; C (1 - cos d) * 2^42
+    NOT.B   D7
+    TST.B   D7
+    BSR     pcomb
+    ADD.L   4(A2),D0
+    BSR     pack
+    MOVE.L  44(A7),A0
+    MOVE.L  D0,(A0)
+    MOVEM.L (A7)+,D2-D7/A2-A3
+    RTS
+
+* D0:D1 = +-(D5 * 2^-37) - (D0 * 2^-42) in Q0.32:Q32.64,
+* minus the first term when the flags from TST.B say negative
+pcomb:
+    SMI     D4
+    MOVE.L  D0,D3
+    MOVEQ   #10,D2
+    LSR.L   D2,D0
+    MOVEQ   #22,D2
+    LSL.L   D2,D3           ; D0:D3 = second term
+    MOVE.L  D5,D1
+    LSR.L   #5,D5
+    MOVEQ   #27,D2
+    LSL.L   D2,D1           ; D5:D1 = first term
+    TST.B   D4
+    BEQ     pcpos
+    NEG.L   D1
+    NEGX.L  D5
+pcpos:
+    SUB.L   D3,D1
+    SUBX.L  D0,D5
+    MOVE.L  D5,D0
+    MOVEQ   #126,D2         ; value D0:D1 * 2^-32
+    RTS
+
+* r < 2^-6: M = mantissa in Q0.32, r = M * 2^(e-126-32)
+psmall:
+    CMP.W   #115,D1
+    BCS     ptiny           ; r < 2^-12: sin r = r, cos r = 1
+    MOVE.W  D1,D7           ; e
+    AND.L   #$007FFFFF,D0
+    BSET    #23,D0
+    LSL.L   #8,D0
+    MOVE.L  D0,D6           ; M
+    MOVE.L  D0,D1
+    BSR     umh
+    MOVE.L  D0,D5           ; u = M^2 / 2^32, r^2 = u * 2^(2e-252-32)
+    MOVE.W  #252,D4
+    SUB.W   D7,D4
+    SUB.W   D7,D4           ; 2p = 252 - 2e (12..22)
+    MOVE.L  #K6,D1
+    BSR     umh
+    LSR.L   D4,D0           ; r^2/6 in Q0.32
+    MOVE.L  D6,D1
+    BSR     umh
+    SUB.L   D0,D6           ; M (1 - r^2/6)
+    MOVE.L  D6,D0
+    MOVEQ   #0,D1
+    MOVE.W  D7,D2           ; value D0 * 2^(e-126-32)
+    BSR     pack
+    MOVE.L  40(A7),A0
+    MOVE.L  D0,(A0)
+    ADDQ.W  #1,D4
+    LSR.L   D4,D5           ; w = r^2/2 in Q0.32
+    MOVE.L  D5,D0
+    MOVE.L  D5,D1
+    BSR     umh             ; r^4/4
+    MOVE.L  #K6,D1
+    BSR     umh             ; r^4/24
+    SUB.L   D0,D5
+    NEG.L   D5              ; 1 - r^2/2 + r^4/24 in Q0.32
+    MOVE.L  D5,D0
+    MOVEQ   #0,D1
+    MOVEQ   #126,D2
+    BSR     pack
+    BRA     pcout
+ptiny:
+    MOVE.L  40(A7),A0
+    MOVE.L  D0,(A0)
+    MOVE.L  #$3F800000,D0
+    BRA     pcout
+pnan:
+    MOVE.L  40(A7),A0
+    MOVE.L  D0,(A0)
+pcout:
+    MOVE.L  44(A7),A0
+    MOVE.L  D0,(A0)
+    MOVEM.L (A7)+,D2-D7/A2-A3
+    RTS
+
+* atpoly(a), a >= 0: exponent e = 115..152 to the three paths
+_atpoly:
+    MOVEM.L D2-D7/A2-A3,-(A7)
+    MOVE.L  36(A7),D0       ; a
+    MOVE.L  D0,D1
+    SWAP    D1
+    LSR.W   #7,D1           ; biased exponent (a >= 0)
+    CMP.W   #115,D1
+    BCS     aout            ; a < 2^-12: atan a = a
+    CMP.W   #153,D1
+    BCC     abig
+    CMP.W   #122,D1
+    BCS     asml            ; a < 2^-5
+    AND.L   #$007FFFFF,D0
+    BSET    #23,D0          ; M, a = M * 2^(e-150)
+    CMP.W   #127,D1
+    BCC     ahi
+
+* 2^-5 <= a < 1: A = a * 2^28, k = nearest A / 2^24 (1..16)
+    SUB.W   #122,D1
+    LSL.L   D1,D0           ; A
+    MOVE.L  D0,D4
+    ADD.L   #$00800000,D4
+    MOVEQ   #24,D2
+    LSR.L   D2,D4           ; k
+    MOVE.L  D4,D3
+    LSL.L   D2,D3
+    MOVE.L  D0,D5
+    SUB.L   D3,D5           ; (a - b) * 2^28
+    SMI     D7              ; sign of t
+    BPL     alpos
+    NEG.L   D5
+alpos:
+    MOVE.L  D0,D2
+    MULU    D4,D2
+    SWAP    D0
+    MULU    D4,D0
+    SWAP    D0
+    CLR.W   D0
+    ADD.L   D0,D2           ; A k = ab * 2^32
+    LSR.L   #1,D2
+    BSET    #31,D2          ; (1 + ab) * 2^31
+    MOVE.L  D5,D0
+    LSL.L   #7,D0
+    MOVEQ   #0,D1           ; |a - b| * 2^67
+    BSR     udv             ; T = |t| * 2^36
+    LEA     _attb-8,A2
+    LSL.W   #3,D4
+    ADDA.W  D4,A2
+    MOVE.L  (A2),D4
+    MOVE.L  4(A2),D5        ; atan b
+    BSR     apoly
+    BRA     acmb
+
+* 1 <= a < 2^26: k = nearest 16/a from 2^(20-e) / (M >> 8)
+ahi:
+    SUB.W   #127,D1         ; e
+    MOVEQ   #0,D4
+    CMP.W   #6,D1
+    BCC     ahk             ; a >= 64: k = 0
+    MOVE.L  D0,D2
+    LSR.L   #8,D2
+    MOVEQ   #20,D3
+    SUB.W   D1,D3
+    MOVEQ   #1,D5
+    LSL.L   D3,D5
+    DIVU    D2,D5           ; 32/a
+    MOVE.W  D5,D4
+    ADDQ.W  #1,D4
+    LSR.W   #1,D4           ; k
+ahk:
+    MOVE.L  D0,D2
+    MULU    D4,D2
+    MOVE.L  D0,D3
+    SWAP    D3
+    MULU    D4,D3
+    SWAP    D3
+    CLR.W   D3
+    ADD.L   D3,D2           ; M k = ab * 2^(27-e)
+    MOVEQ   #27,D3
+    SUB.W   D1,D3
+    MOVEQ   #1,D5
+    LSL.L   D3,D5
+    SUB.L   D2,D5           ; (1 - ab) * 2^(27-e)
+    SMI     D7
+    BPL     ahpos
+    NEG.L   D5
+ahpos:
+    LSL.L   #4,D0
+    MOVEQ   #23,D3
+    SUB.W   D1,D3
+    MOVE.L  D4,D2
+    LSL.L   D3,D2           ; (k = 0 when e > 5)
+    ADD.L   D0,D2           ; (a + b) * 2^(27-e)
+    MOVE.L  D5,D0
+    LSL.L   #4,D0
+    MOVEQ   #0,D1
+    BSR     udv             ; T = |t| * 2^36
+    MOVE.L  _q2pi2,D2
+    MOVE.L  _q2pi2+4,D5
+    TST.W   D4
+    BEQ     ahnb
+    LEA     _attb-8,A2
+    LSL.W   #3,D4
+    ADDA.W  D4,A2
+    SUB.L   4(A2),D5
+    MOVE.L  (A2),D3
+    SUBX.L  D3,D2           ; pi/2 - atan b
+ahnb:
+    MOVE.L  D2,D4
+    BSR     apoly
+    NOT.B   D7
+
+* D4:D5 +/- D0:D1 (minus when D7 is set), to spf
+acmb:
+    TST.B   D7
+    BNE     acsub
+    ADD.L   D1,D5
+    ADDX.L  D0,D4
+    BRA     acpk
+acsub:
+    SUB.L   D1,D5
+    SUBX.L  D0,D4
+acpk:
+    MOVE.L  D4,D0
+    MOVE.L  D5,D1
+    MOVE.W  #128,D2         ; Q2.62
+    BSR     pack
+    BRA     aout
+
+* 2^-12 <= a < 2^-5: M = mantissa in Q0.32, a = M * 2^(e-126-32)
+asml:
+    AND.L   #$007FFFFF,D0
+    BSET    #23,D0
+    LSL.L   #8,D0
+    MOVE.L  D0,D6           ; M
+    MOVE.W  D1,D7           ; e
+    MOVE.L  D0,D1
+    BSR     umh
+    MOVE.L  D0,D5           ; u = M^2 / 2^32
+    MOVE.W  #252,D4
+    SUB.W   D7,D4
+    SUB.W   D7,D4           ; 2p = 252 - 2e (12..22)
+    MOVE.L  #K3,D1
+    BSR     umh
+    LSR.L   D4,D0
+    MOVE.L  D0,A1           ; a^2/3 in Q0.32
+    MOVE.L  D5,D0
+    LSR.L   D4,D0           ; a^2
+    MOVE.L  D0,D1
+    BSR     umh
+    MOVE.L  #K5,D1
+    BSR     umh             ; a^4/5
+    MOVE.L  A1,D1
+    SUB.L   D0,D1
+    MOVE.L  D6,D0
+    BSR     umh
+    SUB.L   D0,D6           ; M (1 - a^2/3 + a^4/5)
+    MOVE.L  D6,D0
+    MOVEQ   #0,D1
+    MOVE.W  D7,D2
+    BSR     pack
+    BRA     aout
+abig:
+    CMP.W   #255,D1
+    BNE     api2
+    MOVE.L  D0,D2
+    AND.L   #$007FFFFF,D2
+    BNE     aout            ; NaN
+api2:
+    MOVE.L  #$3FC90FDB,D0   ; pi/2
+aout:
+    MOVEM.L (A7)+,D2-D7/A2-A3
+    RTS
+
+* D0:D1 = atan(D1 * 2^-36) * 2^62 for D1 * 2^-36 <= 1/32:
+* T - T^3/3 + T^5/5; D4, D5 and D7 are kept
+apoly:
+    MOVE.L  D1,D6           ; T
+    MOVE.L  D1,D0
+    BSR     umh
+    MOVE.L  D0,A1           ; t^2 * 2^40
+    MOVE.L  #K3,D1
+    BSR     umh
+    MOVE.L  D6,D1
+    BSR     umh
+    LSR.L   #8,D0
+    MOVE.L  D0,A3           ; t^3/3 * 2^36
+    MOVE.L  A1,D0
+    MOVE.L  A1,D1
+    BSR     umh             ; t^4 * 2^48
+    MOVE.L  #K5,D1
+    BSR     umh
+    MOVE.L  D6,D1
+    BSR     umh
+    CLR.W   D0
+    SWAP    D0              ; t^5/5 * 2^36
+    ADD.L   D6,D0
+    SUB.L   A3,D0
+    MOVE.L  D0,D1
+    LSR.L   #6,D0
+    MOVEQ   #26,D2
+    LSL.L   D2,D1
+    RTS
+
+* D1 = D0:D1 / D2, D0 < D2; the remainder is left in D0
+udv:
+    MOVEQ   #31,D3
+udvl:
+    ADD.L   D1,D1
+    ADDX.L  D0,D0
+    BCS     udvs
+    CMP.L   D2,D0
+    BCS     udvn
+udvs:
+    SUB.L   D2,D0
+    ADDQ.L  #1,D1
+udvn:
+    DBRA    D3,udvl
+    RTS
+
+* D0 = high long of D0 * D1 (unsigned); D1-D3 and A0 are used
+umh:
+    MOVE.L  D4,A0
+    MOVE.L  D0,D2
+    SWAP    D2              ; xh
+    MOVE.L  D1,D3
+    SWAP    D3              ; yh
+    MOVE.W  D2,D4
+    MULU    D3,D4           ; xh*yh
+    MULU    D1,D2           ; xh*yl
+    MULU    D0,D3           ; xl*yh
+    MULU    D1,D0           ; xl*yl
+    CLR.W   D0
+    SWAP    D0
+    ADD.L   D2,D0
+    ADD.L   D3,D0           ; middle, carry out is 2^48
+    MOVEQ   #0,D1
+    ADDX.L  D1,D1
+    SWAP    D1
+    CLR.W   D0
+    SWAP    D0
+    ADD.L   D1,D0
+    ADD.L   D4,D0
+    MOVE.L  A0,D4
+    RTS
+
+* pack D0:D1 (D0 <> 0), value D0:D1 * 2^(D2-126-32), to spf in D0,
+* normalizing and rounding once to nearest-even
+pack:
+    TST.L   D0
+    BMI     pknrm
+pkl:
+    ADD.L   D1,D1
+    ADDX.L  D0,D0
+    SUBQ.W  #1,D2
+    TST.L   D0
+    BPL     pkl
+pknrm:
+    MOVE.B  D0,D3
+    TST.L   D1
+    BEQ     pkr
+    OR.B    #1,D3           ; sticky
+pkr:
+    CMP.B   #$80,D3
+    BCS     pkt
+    BHI     pku
+    BTST    #8,D0
+    BEQ     pkt             ; tie, already even
+pku:
+    ADD.L   #$00000100,D0
+    BCC     pkt
+    MOVE.L  #$80000000,D0   ; rounded up to 2^32
+    ADDQ.W  #1,D2
+pkt:
+    LSR.L   #8,D0
+    BCLR    #23,D0
+    AND.L   #$000000FF,D2
+    SWAP    D2
+    LSL.L   #7,D2
+    OR.L    D2,D0
+    RTS
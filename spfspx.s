@@ -0,0 +1,548 @@
+*-----------------------------------------------------------
+* Title      : spfspx.s
+* Written by : J. Lovrinic
+* Date       : 20261017
+*              unpacked extended type (spx) for chains of
+*              operations: fpspx, spx_fp, spxadd, spxsub,
+*              spxmul, spxdiv and spxfma
+*
+*   An spx holds a separate sign word (0 or -1), a 16-bit
+*   unbiased exponent and a 32-bit mantissa with its leading
+*   one in bit 31 (value = man * 2^(exp-31)).  Zero has a
+*   zero mantissa and exponent SPXZE, inf and NaN exponent
+*   SPXIE.  The operations work on that form directly and
+*   round half up to 32 bits, so a chain keeps 8 bits more
+*   than spf and pays for one nearest-even rounding and one
+*   pack, in spx_fp, at the end.  Results past the spx
+*   exponent range give inf or zero; SPFINV, SPFDZ, SPFOVF,
+*   SPFUNF and SPFINX are raised in spfenv as in spfmul.
+*   a/0 gives the IEEE signed inf, where spfdiv keeps the
+*   library's NaN.  Only D2-D5 are saved.
+*
+*   Cycle counts (68000, no wait states, JSR not included,
+*   random normal operands; spx times are pointer in/out
+*   with no unpack or pack, spf times the packed routines):
+*                       spx             spf
+*     add               478-754         562-694
+*       average         527             598
+*     mul               666-784         742-840
+*       average         719             790
+*     div               1016-1158       1002-1176
+*       average         1058            1064
+*     fma               940-1254        1264-1674
+*       average         1035            1453
+*     fpspx             242-260
+*     spx_fp            240-254
+*-----------------------------------------------------------
+**********************************************************/
+* Copyright 2025 John J Lovrinic                         */
+* Permission is hereby granted, free of charge,          */     
+* to any person obtaining a copy of this software        */
+* and associated documentation files (the “Software”),   */
+* to deal in the Software without restriction,           */
+* including without limitation the rights to use,        */
+* copy, modify, merge, publish, distribute, sublicense,  */
+* and/or sell copies of the Software, and to permit      */
+* persons to whom the Software is furnished to do so,    */
+* subject to the following conditions:                   */
+*                                                        */
+* The above copyright notice and this permission notice  */
+* shall be included in all copies or substantial         */
+* portions of the Software.                              */
+*                                                        */
+* THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY     */
+* OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT     */
+* LIMITED TO THE WARRANTIES OF MERCHANTABILITY,          */
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  */
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS     */
+* BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,   */
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,   */
+* ARISING FROM, OUT OF OR IN CONNECTION WITH THE         */
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE. */
+**********************************************************/
+    .globl      _fpspx
+    .globl      _spx_fp
+    .globl      _spxadd
+    .globl      _spxsub
+    .globl      _spxmul
+    .globl      _spxdiv
+    .globl      _spxfma
+    .globl      xunpk
+    .globl      xpack
+    .globl      xadd
+    .globl      xmul
+    .globl      _spfenv
+
+* sticky status flags, as in spflib.h
+SPFINV  .equ    $0001
+SPFDZ   .equ    $0002
+SPFOVF  .equ    $0004
+SPFUNF  .equ    $0008
+SPFINX  .equ    $0010
+
+* exponent words of the special values
+SPXIE   .equ    $4000           ; inf (man $80000000) and NaN (man $C0000000)
+SPXZE   .equ    $C000           ; zero (man 0)
+
+* fpspx(r, a): unpack spf a into *r; denormals read as zero
+_fpspx:
+    MOVE.L  8(A7),D0
+    BSR     xunpk
+    MOVE.L  4(A7),A0
+    MOVE.L  D0,(A0)+
+    MOVE.L  D1,(A0)
+    RTS
+
+* xunpk: spf in D0 to D0 (sign : exp) and D1 (man)
+xunpk:
+    MOVE.L  D0,D1
+    CLR.W   D1
+    SWAP    D1
+    AND.W   #$7F80,D1       ; D1 = 0 : (e << 7)
+    BEQ     xfzero
+    CMP.W   #$7F80,D1
+    BEQ     xfspc
+    LSR.W   #7,D1
+    SUB.W   #127,D1
+    TST.L   D0
+    BPL     xfpos
+    OR.L    #$FFFF0000,D1   ; sign word -1
+xfpos:
+    LSL.L   #8,D0
+    BSET    #31,D0          ; hidden bit
+    EXG     D0,D1
+    RTS
+xfzero:
+    MOVE.L  #SPXZE,D0
+    MOVEQ   #0,D1
+    RTS
+xfspc:
+    MOVE.L  #SPXIE,D1
+    AND.L   #$807FFFFF,D0
+    BEQ     xfinf
+    BPL     xfnan           ; NaN
+    CMP.L   #$80000000,D0
+    BNE     xfnan
+    OR.L    #$FFFF0000,D1   ; -inf
+xfinf:
+    MOVE.L  D1,D0
+    MOVE.L  #$80000000,D1
+    RTS
+xfnan:
+    MOVE.L  #SPXIE,D0
+    MOVE.L  #$C0000000,D1
+    RTS
+
+* spx_fp(z): round *z once to nearest-even and pack it
+_spx_fp:
+    MOVE.L  4(A7),A0
+    MOVE.L  (A0),D1         ; sign : exp
+    MOVE.L  4(A0),D0        ; man
+
+* xpack: D1 (sign : exp) and D0 (man) to an spf in D0
+xpack:
+    CMP.W   #SPXIE,D1
+    BEQ     xpspc
+    TST.L   D0
+    BEQ     xpfin           ; zero gives +0
+    ADD.W   #126,D1         ; biased exponent - 1
+    BMI     xpunf
+    CMP.W   #253,D1
+    BGT     xpovf
+    MOVE.L  D2,A1
+    MOVE.B  D0,D2           ; round bits
+    LSR.L   #8,D0
+    TST.B   D2
+    BEQ     xppack          ; exact
+    OR.W    #SPFINX,_spfenv
+    CMP.B   #$80,D2
+    BCS     xppack
+    BHI     xprnd
+    BTST    #0,D0
+    BEQ     xppack          ; tie and already even
+xprnd:
+    ADDQ.L  #1,D0           ; a carry to 2^24 bumps the exponent when packed
+    BTST    #24,D0
+    BEQ     xppack
+    CMP.W   #253,D1
+    BNE     xppack
+    OR.W    #SPFOVF,_spfenv ; rounded up to infinity
+xppack:
+    MOVE.W  D1,D2
+    LSL.W   #7,D2
+    SWAP    D2
+    CLR.W   D2
+    ADD.L   D2,D0
+    MOVE.L  A1,D2
+    TST.L   D1
+    BPL     xpfin
+    BSET    #31,D0
+xpfin:
+    RTS
+xpunf:
+    OR.W    #SPFUNF+SPFINX,_spfenv
+    MOVEQ   #0,D0
+    RTS
+xpovf:
+    OR.W    #SPFOVF+SPFINX,_spfenv
+    MOVE.L  #$80000000,D0
+xpspc:
+    BTST    #30,D0
+    BEQ     xpinf
+    MOVE.L  #$7FC00000,D0   ; NaN
+    RTS
+xpinf:
+    MOVE.L  #$7F800000,D0
+    TST.L   D1
+    BPL     xpfin
+    BSET    #31,D0
+    RTS
+
+* spxadd(r, a, b) and spxsub(r, a, b): *r = a + b, a - b
+_spxsub:
+    MOVE.L  #$FFFF0000,D0   ; flips the sign word of b
+    BRA     xsub1
+_spxadd:
+    MOVEQ   #0,D0
+xsub1:
+    MOVEM.L D2-D5,-(A7)
+    MOVE.L  24(A7),A0       ; a (16 bytes of saved registers)
+    MOVE.L  28(A7),A1       ; b
+    MOVE.L  (A0)+,D2
+    MOVE.L  (A0),D3
+    MOVE.L  (A1)+,D4
+    MOVE.L  (A1),D5
+    EOR.L   D0,D4
+    BSR     xadd
+    BRA     xstore
+
+* spxmul(r, a, b): *r = a * b
+_spxmul:
+    MOVEM.L D2-D5,-(A7)
+    MOVE.L  24(A7),A0
+    MOVE.L  28(A7),A1
+    MOVE.L  (A0)+,D2
+    MOVE.L  (A0),D3
+    MOVE.L  (A1)+,D4
+    MOVE.L  (A1),D5
+    BSR     xmul
+    BRA     xstore
+
+* spxdiv(r, a, b): *r = a / b
+_spxdiv:
+    MOVEM.L D2-D5,-(A7)
+    MOVE.L  24(A7),A0
+    MOVE.L  28(A7),A1
+    MOVE.L  (A0)+,D2
+    MOVE.L  (A0),D3
+    MOVE.L  (A1)+,D4
+    MOVE.L  (A1),D5
+    BSR     xdiv
+    BRA     xstore
+
+* spxfma(r, a, b, c): *r = a * b + c, the product kept to 32 bits
+_spxfma:
+    MOVEM.L D2-D5,-(A7)
+    MOVE.L  24(A7),A0
+    MOVE.L  28(A7),A1
+    MOVE.L  (A0)+,D2
+    MOVE.L  (A0),D3
+    MOVE.L  (A1)+,D4
+    MOVE.L  (A1),D5
+    BSR     xmul
+    MOVE.L  32(A7),A0       ; c
+    MOVE.L  (A0)+,D4
+    MOVE.L  (A0),D5
+    BSR     xadd
+
+* store D2 (sign : exp) and D3 (man) through r
+xstore:
+    MOVE.L  20(A7),A0
+    MOVE.L  D2,(A0)+
+    MOVE.L  D3,(A0)
+    MOVEM.L (A7)+,D2-D5
+    RTS
+
+* xadd: D2/D3 += D4/D5; the smaller operand is aligned with
+*       round-half-up on the last bit shifted out.  xunpk,
+*       xadd and xmul use D0-D5 only, xpack D0-D5 and A1 (D2
+*       is kept there); they are the register kernels for
+*       spfvec.s.
+xadd:
+    CMP.W   #SPXIE,D2
+    BEQ     xaspa           ; a is inf/NaN
+    CMP.W   #SPXIE,D4
+    BEQ     xab             ; b is inf/NaN, a finite: b
+    TST.L   D5
+    BEQ     xaret           ; b is zero: a
+    TST.L   D3
+    BEQ     xab             ; a is zero: b
+    MOVE.W  D2,D1
+    SUB.W   D4,D1           ; expDiff
+    BGE     xa1
+    EXG     D2,D4           ; larger exponent into D2/D3
+    EXG     D3,D5
+    NEG.W   D1
+xa1:
+    CMP.W   #33,D1
+    BCC     xaret           ; b lies below the round bit of a
+    TST.W   D1
+    BEQ     xa2
+    SUBQ.W  #1,D1
+    LSR.L   D1,D5
+    LSR.L   #1,D5           ; X = first bit shifted out
+    MOVEQ   #0,D1
+    ADDX.L  D1,D5
+xa2:
+    MOVE.L  D2,D1
+    EOR.L   D4,D1
+    BMI     xasub           ; signs differ
+    ADD.L   D5,D3
+    BCC     xaret
+    ROXR.L  #1,D3           ; carry back in at bit 31
+    BCC     xa3
+    ADDQ.L  #1,D3           ; round half up
+    BCC     xa3
+    ROXR.L  #1,D3           ; rounded up to 2^32
+    ADDQ.W  #1,D2
+xa3:
+    ADDQ.W  #1,D2
+xarng:
+    CMP.W   #SPXIE,D2
+    BGE     xovf
+xaret:
+    RTS
+xab:
+    MOVE.L  D4,D2
+    MOVE.L  D5,D3
+    RTS
+xasub:
+    SUB.L   D5,D3
+    BEQ     xzero           ; exact cancellation gives +0
+    BCC     xanrm
+    NEG.L   D3              ; b was larger: its sign
+    MOVE.W  D2,D4
+    MOVE.L  D4,D2
+xanrm:
+    TST.L   D3
+    BMI     xaret
+    CMP.L   #$00010000,D3
+    BCC     xan8
+    SWAP    D3              ; 16 bits at once
+    SUB.W   #16,D2
+xan8:
+    CMP.L   #$01000000,D3
+    BCC     xan1
+    LSL.L   #8,D3
+    SUBQ.W  #8,D2
+xan1:
+    TST.L   D3
+    BMI     xmrng
+xanl:
+    SUBQ.W  #1,D2
+    ADD.L   D3,D3
+    BPL     xanl
+    BRA     xmrng
+xaspa:
+    CMP.W   #SPXIE,D4       ; a is inf/NaN
+    BNE     xaret
+    BTST    #30,D3
+    BNE     xaret           ; NaN + b
+    BTST    #30,D5
+    BNE     xab             ; inf + NaN
+    MOVE.L  D2,D1
+    EOR.L   D4,D1
+    BMI     xinv            ; inf - inf
+    RTS
+
+* xmul: D2/D3 *= D4/D5, 64-bit product from four MULU, rounded
+*       half up to 32 bits
+xmul:
+    CMP.W   #SPXIE,D2
+    BEQ     xmspc
+    CMP.W   #SPXIE,D4
+    BEQ     xmspc
+    MOVE.W  D2,D1
+    EOR.L   D4,D2           ; sign word: sa ^ sb
+    MOVE.W  D1,D2
+    ADD.W   D4,D2           ; exponent: ea + eb
+    MOVE.L  D3,D1
+    AND.L   D5,D1
+    BPL     xzero           ; a or b is zero (bit 31 clear)
+    MOVE.W  D3,D0
+    MULU    D5,D0           ; D0 = al*bl
+    SWAP    D3              ; D3.w = ah
+    MOVE.W  D3,D1
+    MULU    D5,D1           ; D1 = ah*bl
+    SWAP    D5              ; D5.w = bh
+    MOVE.L  D3,D4
+    SWAP    D4              ; D4.w = al
+    MULU    D5,D4           ; D4 = al*bh
+    MULU    D5,D3           ; D3 = ah*bh
+    ADD.L   D1,D4           ; cross terms
+    BCC     xm1
+    ADD.L   #$00010000,D3   ; their carry is worth 2^48
+xm1:
+    SWAP    D4
+    MOVEQ   #0,D1
+    MOVE.W  D4,D1           ; D1 = cross >> 16
+    CLR.W   D4              ; D4 = cross << 16
+    ADD.L   D4,D0
+    ADDX.L  D1,D3           ; D3:D0 = product, 2^62 <= P < 2^64
+    BMI     xm2
+    ADD.L   D0,D0           ; product < 2: one more bit
+    ADDX.L  D3,D3
+    BRA     xm3
+xm2:
+    ADDQ.W  #1,D2
+xm3:
+    ADD.L   D0,D0           ; C = round bit
+    BCC     xmrng
+    ADDQ.L  #1,D3
+    BCC     xmrng
+    ROXR.L  #1,D3           ; rounded up to 2^32
+    ADDQ.W  #1,D2
+xmrng:
+    CMP.W   #SPXIE,D2
+    BGE     xovf
+    CMP.W   #SPXZE,D2
+    BLE     xunf
+    RTS
+xmspc:
+    MOVE.L  D2,D1           ; inf/NaN operand: D1 = sign word of the product
+    EOR.L   D4,D1
+    CMP.W   #SPXIE,D2
+    BNE     xms1
+    BTST    #30,D3
+    BNE     xnan
+xms1:
+    CMP.W   #SPXIE,D4
+    BNE     xms2
+    BTST    #30,D5
+    BNE     xnan
+xms2:
+    TST.L   D3
+    BEQ     xinv            ; 0 * inf
+    TST.L   D5
+    BEQ     xinv            ; inf * 0
+    MOVE.L  D1,D2
+    BRA     xinf
+
+* xdiv: D2/D3 /= D4/D5, radix 2^16 long division as in spfdiv.s
+*       (D5 = divisor, D4.w = its high word, D0 = remainder,
+*       D3 = quotient), rounded half up to 32 bits
+xdiv:
+    CMP.W   #SPXIE,D2
+    BEQ     xdspc
+    CMP.W   #SPXIE,D4
+    BEQ     xdspc
+    MOVE.W  D2,D1
+    EOR.L   D4,D2           ; sign word: sa ^ sb
+    MOVE.W  D1,D2
+    SUB.W   D4,D2           ; exponent: ea - eb
+    TST.L   D5
+    BEQ     xddz            ; x/0
+    MOVE.L  D3,D0
+    BEQ     xzero           ; 0/y
+    MOVE.L  D5,D4
+    SWAP    D4
+    CMP.L   D5,D0
+    BCS     xdlow
+    SUB.L   D5,D0           ; ma >= mb: a leading one and 31 bits
+    BSR     xdstep
+    SWAP    D3
+    BSR     xdstep
+    LSR.L   #1,D3
+    BSET    #31,D3
+    MOVEQ   #0,D1
+    ADDX.L  D1,D3           ; round half up on the dropped bit
+    BRA     xmrng
+xdlow:
+    SUBQ.W  #1,D2           ; ma < mb: 32 quotient bits
+    BSR     xdstep
+    SWAP    D3
+    BSR     xdstep
+    ADD.L   D0,D0           ; round half up: 2*rem >= divisor
+    BCS     xdup
+    CMP.L   D5,D0
+    BCS     xmrng
+xdup:
+    ADDQ.L  #1,D3
+    BCC     xmrng
+    ROXR.L  #1,D3           ; rounded up to 2^32
+    ADDQ.W  #1,D2
+    BRA     xmrng
+xdstep:
+    MOVE.L  D0,D1
+    SWAP    D1
+    CMP.W   D4,D1
+    BEQ     xdful           ; high words equal: digit estimate is $FFFF
+    MOVE.L  D0,D1
+    DIVU    D4,D1           ; D1 = rem : qhat
+    MOVE.W  D1,D3
+    MOVE.W  D1,D0
+    MULU    D5,D0           ; qhat * low divisor word
+    CLR.W   D1              ; rem << 16
+    SUB.L   D0,D1
+    EXG     D1,D0           ; new remainder, carry if it went negative
+    BCC     xdsx
+xdfix:
+    SUBQ.W  #1,D3           ; add back until the remainder is >= 0
+    ADD.L   D5,D0
+    BCC     xdfix
+xdsx:
+    RTS
+xdful:
+    MOVE.W  #$FFFF,D3
+    MOVE.W  D5,D1
+    SUB.W   D0,D1           ; (low divisor - low remainder) << 16
+    SWAP    D1
+    CLR.W   D1
+    MOVE.L  D5,D0
+    SUB.L   D1,D0
+    BCC     xdsx
+    BRA     xdfix
+xddz:
+    TST.L   D3
+    BEQ     xinv            ; 0/0
+    OR.W    #SPFDZ,_spfenv
+    BRA     xinf
+xdspc:
+    MOVE.L  D2,D1           ; inf/NaN operand: D1 = sign word of the quotient
+    EOR.L   D4,D1
+    CMP.W   #SPXIE,D2
+    BNE     xds1
+    BTST    #30,D3
+    BNE     xnan            ; NaN/y
+    CMP.W   #SPXIE,D4
+    BEQ     xds2
+    MOVE.L  D1,D2           ; inf/y
+    BRA     xinf
+xds1:
+    BTST    #30,D5
+    BNE     xnan            ; x/NaN
+    BRA     xzero           ; x/inf
+xds2:
+    BTST    #30,D5
+    BNE     xnan
+    BRA     xinv            ; inf/inf
+
+* results out of the spx range, and the special values
+xunf:
+    OR.W    #SPFUNF+SPFINX,_spfenv
+xzero:
+    MOVE.L  #SPXZE,D2
+    MOVEQ   #0,D3
+    RTS
+xovf:
+    OR.W    #SPFOVF+SPFINX,_spfenv
+xinf:
+    MOVE.W  #SPXIE,D2
+    MOVE.L  #$80000000,D3
+    RTS
+xinv:
+    OR.W    #SPFINV,_spfenv
+xnan:
+    MOVE.L  #SPXIE,D2
+    MOVE.L  #$C0000000,D3
+    RTS
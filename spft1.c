@@ -38,11 +38,12 @@
 #define SPF_RT3_2   0x3F5DB3D7L  // sqrt(3)/2
 #define LOCK_EPS    0x358637BDL  // ~1e-6 (radians)
 
-/* file-private CORDIC atan table */
-#define NCORDTB	40
+/* CORDIC atan(2^-i) table in Q2.62, spftbl.s (mktbl.c) */
 #define NCORD	26
-static q2d cordtb[NCORDTB];
-static long cord_ok = 0L;
+extern q2d atntb[];
+
+/* hyperbolic CORDIC atanh(2^-i) in step order, spftbl.s (mktbl.c) */
+extern q2d athtb[];
 
 // q2 helpers: prototypes (pointer-out, void return)
 void q2asgn();
@@ -52,12 +53,26 @@ void q2sub();
 long q2cmp();
 void q2dbg();
 
-// reducer we’re using now
+// reducer: angle in [0, pi/4] and octant 0..7 in one step (spfred.s)
 spf octred();
 
-// CORDIC kernel
+// CORDIC kernel; the rotation steps come from spfcrd.s.  Comment
+// out CRDASM (and drop spfcrd.o from cspf.sub) to build the C loop
+// below instead; the results are bit-identical.
+#define CRDASM 1
+void q2rot();
+void q2hyp();
+void q2hvc();
+void q1rot();
 void cord8();
 
+// SCPOLY: sin and cos of the reduced angle from the table and
+// polynomial kernel scpoly (spfscp.s) instead of cord8.  Faster
+// and within 0.54 ulp where cord8 loses bits below 2^-6; see
+// the spfscp.s header for the numbers.
+//#define SCPOLY 1
+void scpoly();
+
 #define P2_30 0x4E800000L	// 2^30
 #define P2_32 0x4F800000L	// 2^32
 #define P2_54 0x5A800000L	// 2^(30+24)
@@ -173,11 +188,7 @@ long n;
 	}
 	if (n >= 32L) {
 		shi = a->hi;
-		if (n == 32L) {
-			r->lo = (unsigned long)shi;
-		} else {
-			r->lo = (unsigned long)((unsigned long)shi >> (n - 32L));
-		}
+		r->lo = shi >> (n - 32L);
 		r->hi = (shi < 0L) ? 0xFFFFFFFFL : 0x00000000L;
 		return;
 	}
@@ -266,158 +277,257 @@ q2d *z;
 	return q2_fp(h);
 }
 
-// Load atan(2^-i) table in Q2.62 intocordtb[0..25]
-// NOTE: indices 26..40 below exceed cordtb[26]; keep table size consistent if you use them.
-void cordin()
-{
-	cord_ok=1L;
-	
-	cordtb[0].hi = 0x3243F6A8L; cordtb[0].lo = 0x885A3000L;	// atan(2^-0)  = π/4
-	cordtb[1].hi = 0x1DAC6705L; cordtb[1].lo = 0x61BB4F00L;	// atan(2^-1)
-	cordtb[2].hi = 0x0FADBAFCL; cordtb[2].lo = 0x96406E80L;	// atan(2^-2)
-	cordtb[3].hi = 0x07F56EA6L; cordtb[3].lo = 0xAB0BDB80L;	// atan(2^-3)
-	cordtb[4].hi = 0x03FEAB76L; cordtb[4].lo = 0xE59FBD40L;	// atan(2^-4)
-	cordtb[5].hi = 0x01FFD55BL; cordtb[5].lo = 0xBA976250L;	// atan(2^-5)
-	cordtb[6].hi = 0x00FFFAAAL; cordtb[6].lo = 0xDDDB94D8L;	// atan(2^-6)
-	cordtb[7].hi = 0x007FFF55L; cordtb[7].lo = 0x56EEEA5CL;	// atan(2^-7)
-	cordtb[8].hi = 0x003FFFEAL; cordtb[8].lo = 0xAAB7776EL;	// atan(2^-8)
-	cordtb[9].hi = 0x001FFFFDL; cordtb[9].lo = 0x5555BBBCL;	// atan(2^-9)
-	cordtb[10].hi = 0x000FFFFFL; cordtb[10].lo = 0xAAAAADDEL;	// atan(2^-10)
-	cordtb[11].hi = 0x0007FFFFL; cordtb[11].lo = 0xF555556FL;	// atan(2^-11)
-	cordtb[12].hi = 0x0003FFFFL; cordtb[12].lo = 0xFEAAAAACL;	// atan(2^-12)
-	cordtb[13].hi = 0x0001FFFFL; cordtb[13].lo = 0xFFD55555L;	// atan(2^-13)
-	cordtb[14].hi = 0x0000FFFFL; cordtb[14].lo = 0xFFFAAAABL;	// atan(2^-14)
-	cordtb[15].hi = 0x00007FFFL; cordtb[15].lo = 0xFFFF5555L;	// atan(2^-15)
-	cordtb[16].hi = 0x00003FFFL; cordtb[16].lo = 0xFFFFEAABL;	// atan(2^-16)
-	cordtb[17].hi = 0x00001FFFL; cordtb[17].lo = 0xFFFFFD55L;	// atan(2^-17)
-	cordtb[18].hi = 0x00000FFFL; cordtb[18].lo = 0xFFFFFFABL;	// atan(2^-18)
-	cordtb[19].hi = 0x000007FFL; cordtb[19].lo = 0xFFFFFFF5L;	// atan(2^-19)
-	cordtb[20].hi = 0x000003FFL; cordtb[20].lo = 0xFFFFFFFEL;	// atan(2^-20)
-	cordtb[21].hi = 0x000001FFL; cordtb[21].lo = 0xFFFFFFFFL;	// atan(2^-21)
-	cordtb[22].hi = 0x000000FFL; cordtb[22].lo = 0xFFFFFFFFL;	// atan(2^-22)
-	cordtb[23].hi = 0x0000007FL; cordtb[23].lo = 0xFFFFFFFFL;	// atan(2^-23)
-	cordtb[24].hi = 0x0000003FL; cordtb[24].lo = 0xFFFFFFFFL;	// atan(2^-24)
-	cordtb[25].hi = 0x0000001FL; cordtb[25].lo = 0xFFFFFFFFL;	// atan(2^-25)
-
-	// The following entries are plain 2^-k scalars, not atan angles.
-	// They are unused by cord8() (loops 26 steps), but kept here if you expand iterations.
-	cordtb[26].hi = 0x00000010L; cordtb[26].lo = 0x00000000L;	// 2^-26
-	cordtb[27].hi = 0x00000008L; cordtb[27].lo = 0x00000000L;	// 2^-27
-	cordtb[28].hi = 0x00000004L; cordtb[28].lo = 0x00000000L;	// 2^-28
-	cordtb[29].hi = 0x00000002L; cordtb[29].lo = 0x00000000L;	// 2^-29
-	cordtb[30].hi = 0x00000001L; cordtb[30].lo = 0x00000000L;	// 2^-30
-	cordtb[31].hi = 0x00000000L; cordtb[31].lo = 0x80000000L;	// 2^-31
-	cordtb[32].hi = 0x00000000L; cordtb[32].lo = 0x40000000L;	// 2^-32
-	cordtb[33].hi = 0x00000000L; cordtb[33].lo = 0x20000000L;	// 2^-33
-	cordtb[34].hi = 0x00000000L; cordtb[34].lo = 0x10000000L;	// 2^-34
-	cordtb[35].hi = 0x00000000L; cordtb[35].lo = 0x08000000L;	// 2^-35
-	cordtb[36].hi = 0x00000000L; cordtb[36].lo = 0x04000000L;	// 2^-36
-	cordtb[37].hi = 0x00000000L; cordtb[37].lo = 0x02000000L;	// 2^-37
-	cordtb[38].hi = 0x00000000L; cordtb[38].lo = 0x01000000L;	// 2^-38
-	cordtb[39].hi = 0x00000000L; cordtb[39].lo = 0x00800000L;	// 2^-39
-}
-
 // ------------- CORDIC core (0..pi/8) -------------
-void cord8(a, sp, cp)
-spf a;
-spf *sp;
-spf *cp;
+#ifndef CRDASM
+// n rotation-mode steps on x, y, z (portable version of spfcrd.s)
+void q2rot(x, y, z, n)
+q2d *x;
+q2d *y;
+q2d *z;
+long n;
 {
-	q2d x;
-	q2d y;
-	q2d z;
 	q2d xn;
 	q2d yn;
 	q2d t1;
 	q2d t2;
 	WORD i;
 
-	fpq2d(&z, a);
-	x.hi = 0x26DD3B6AL;
-	x.lo = 0x10D7969AL;
-	y.hi = 0x00000000L;
-	y.lo = 0x00000000L;
-	for (i = 0; i < NCORD; i++) {
-		q2asgn(&xn, &x);
-		q2asgn(&yn, &y);
-		if (z.hi < 0L) {
+	for (i = 0; i < (WORD)n; i++) {
+		q2asgn(&xn, x);
+		q2asgn(&yn, y);
+		if (z->hi < 0L) {
 			q2shr(&t1, &yn, (long)i);
-			q2add(&x, &xn, &t1);
+			q2add(x, &xn, &t1);
 			q2shr(&t2, &xn, (long)i);
-			q2sub(&y, &yn, &t2);
-			q2add(&z, &z, &cordtb[i]);
+			q2sub(y, &yn, &t2);
+			q2add(z, z, &atntb[i]);
 		} else {
 			q2shr(&t1, &yn, (long)i);
-			q2sub(&x, &xn, &t1);
+			q2sub(x, &xn, &t1);
 			q2shr(&t2, &xn, (long)i);
-			q2add(&y, &yn, &t2);
-			q2sub(&z, &z, &cordtb[i]);
+			q2add(y, &yn, &t2);
+			q2sub(z, z, &atntb[i]);
 		}
 #ifdef DEBUG
 		printf("iter %2d: x=0x%08lX%08lX y=0x%08lX%08lX z=0x%08lX%08lX\n",
 		       (int)i,
-		       (unsigned long)x.hi, (unsigned long)x.lo,
-		       (unsigned long)y.hi, (unsigned long)y.lo,
-		       (unsigned long)z.hi, (unsigned long)z.lo);
+		       (unsigned long)x->hi, (unsigned long)x->lo,
+		       (unsigned long)y->hi, (unsigned long)y->lo,
+		       (unsigned long)z->hi, (unsigned long)z->lo);
 #endif
 	}
-	*cp = q2d_fp(&x);
-	*sp = q2d_fp(&y);
 }
 
-// Reduce an angle to the first octant [0, π/4] and return octant index (0..7)
-// a  : input angle (radians, SPF)
-// *poct : output octant number
-// ret: reduced angle in [0, π/4]
-/* octred - reduce angle to [0, pi/4]; return octant 0..7 via *poct */
-/* octred - reduce angle to [0, pi/4]; return octant 0..7 via *poct */
-// ret: reduced angle in [0, π/4]
-spf octred(a, poct)
-spf a;
-long *poct;
-{
-    spf pi     = 0x40490FDBL;  /* π */
-    spf pio2   = 0x3FC90FD8L;  /* π/2 */
-    spf twopi  = spfadd(pi, pi);
-    spf t, q;
-    long oct;
-    WORD w;
-
-    /* wrap a into [0, 2π) */
-    while (spfcmp(a, 0x00000000L) < 0L)  a = spfadd(a, twopi);
-    while (spfcmp(a, twopi)       >= 0L) a = spfsub(a, twopi);
-
-    /* octant index: floor( (a/(π/2)) * 2 ) */
-    t   = spfmul(spfdiv(a, pio2), 0x40000000L); /* *2.0f */
-    q   = spfint(t);
-    oct = spflng(q);
-
-    /* Clamp to 0..7; if it rounded to 8 (i.e., a==2π), treat as 0 with angle 0 */
-    if (oct < 0L) oct = 0L;
-    if (oct > 7L) {
-        *poct = 0L;
-        return spfz;  /* reduced angle = 0 */
-    }
-    *poct = oct;
-    w = (WORD)oct;
-
-    /* map into first octant [0, π/4] */
-    if (w == 0) return a;                          /* [0,   π/4)  */
-    if (w == 1) return spfsub(pio2, a);            /* [π/4, π/2)  */
-    if (w == 2) return spfsub(a, pio2);            /* [π/2, 3π/4) */
-    if (w == 3) return spfsub(pi, a);              /* [3π/4, π)   */
-    if (w == 4) return spfsub(a, pi);              /* [π,   5π/4) */
-    {
-        spf thrp2 = spfadd(pi, pio2);              /* 3π/2 */
-        if (w == 5) return spfsub(thrp2, a);       /* [5π/4, 3π/2) */
-        if (w == 6) return spfsub(a, thrp2);       /* [3π/2, 7π/4) */
-    }
-    /* w == 7 */
-    return spfsub(twopi, a);                       /* [7π/4, 2π) */
+// the same steps in Q2.30, atan(2^-i) from the high long of atntb
+void q1rot(x, y, z, n)
+q2f *x;
+q2f *y;
+q2f *z;
+long n;
+{
+	q2f xi;
+	WORD i;
+
+	for (i = 0; i < (WORD)n; i++) {
+		xi = *x;
+		if (*z < 0L) {
+			*x = xi + (*y >> i);
+			*y = *y - (xi >> i);
+			*z = *z + atntb[i].hi;
+		} else {
+			*x = xi - (*y >> i);
+			*y = *y + (xi >> i);
+			*z = *z - atntb[i].hi;
+		}
+	}
 }
 
+// vectoring steps in Q2.30 (spfatn): turn (x, y) towards y = 0
+void q1vec(x, y, z, n)
+q2f *x;
+q2f *y;
+q2f *z;
+long n;
+{
+	q2f xi;
+	WORD i;
 
+	for (i = 0; i < (WORD)n; i++) {
+		xi = *x;
+		if (*y > 0L) {
+			*x = xi + (*y >> i);
+			*y = *y - (xi >> i);
+			*z = *z + atntb[i].hi;
+		} else {
+			*x = xi - (*y >> i);
+			*y = *y + (xi >> i);
+			*z = *z - atntb[i].hi;
+		}
+	}
+}
+
+void q1vecd(x, y, z, n)
+q2f *x;
+q2f *y;
+q2d *z;
+long n;
+{
+	q2f xi;
+	WORD i;
+
+	for (i = 0; i < (WORD)n; i++) {
+		xi = *x;
+		if (*y > 0L) {
+			*x = xi + (*y >> i);
+			*y = *y - (xi >> i);
+			q2add(z, z, &atntb[i]);
+		} else {
+			*x = xi - (*y >> i);
+			*y = *y + (xi >> i);
+			q2sub(z, z, &atntb[i]);
+		}
+	}
+}
+
+// double-iteration arcsine steps (spfasn, spfacs): turn twice by
+// atan(2^-i), up while y <= t short of pi/2; t grows by 1 + 4^-i
+void q2asn(x, y, z, t, n)
+q2d *x;
+q2d *y;
+q2d *z;
+q2d *t;
+long n;
+{
+	q2d xn;
+	q2d t1;
+	q2d a;
+	WORD i;
+	WORD k;
+	WORD up;
+
+	for (i = 0; i < (WORD)n; i++) {
+		up = (x->hi >= 0L && q2cmp(y, t) <= 0L) ? 1 : 0;
+		for (k = 0; k < 2; k++) {
+			q2asgn(&xn, x);
+			q2shr(&t1, y, (long)i);
+			if (up) q2sub(x, &xn, &t1);
+			else q2add(x, &xn, &t1);
+			q2shr(&t1, &xn, (long)i);
+			if (up) q2add(y, y, &t1);
+			else q2sub(y, y, &t1);
+		}
+		if (i < 32) {
+			q2asgn(&a, &atntb[i]);
+			q2shr(&t1, t, (long)(2 * i));
+			q2add(t, t, &t1);
+		} else {
+			a.hi = 0L;
+			a.lo = 1L << (62 - i);
+		}
+		if (up) q2add(z, z, &a);
+		else q2sub(z, z, &a);
+	}
+}
 
+// n hyperbolic rotation-mode steps (hypair, spfexh), shifts 1, 2,
+// ... with 4, 13, 40 taken twice, athtb[k] the angle of step k
+void q2hyp(x, y, z, n)
+q2d *x;
+q2d *y;
+q2d *z;
+long n;
+{
+	q2d xn;
+	q2d t1;
+	WORD i;
+	WORD k;
+	WORD rep;
+
+	i = 1;
+	rep = 4;
+	for (k = 0; k < (WORD)n; k++) {
+		q2asgn(&xn, x);
+		q2shr(&t1, y, (long)i);
+		if (z->hi < 0L) {
+			q2sub(x, &xn, &t1);
+			q2shr(&t1, &xn, (long)i);
+			q2sub(y, y, &t1);
+			q2add(z, z, &athtb[k]);
+		} else {
+			q2add(x, &xn, &t1);
+			q2shr(&t1, &xn, (long)i);
+			q2add(y, y, &t1);
+			q2sub(z, z, &athtb[k]);
+		}
+		if (i == rep) rep = 3 * rep + 1;
+		else i++;
+	}
+}
+
+// n hyperbolic vectoring-mode steps (atnh, asnh, acnh): y is driven
+// to 0, z gathers atanh(y/x) and x ends at K sqrt(x^2 - y^2)
+void q2hvc(x, y, z, n)
+q2d *x;
+q2d *y;
+q2d *z;
+long n;
+{
+	q2d xn;
+	q2d t1;
+	WORD i;
+	WORD k;
+	WORD rep;
+
+	i = 1;
+	rep = 4;
+	for (k = 0; k < (WORD)n; k++) {
+		q2asgn(&xn, x);
+		q2shr(&t1, y, (long)i);
+		if (y->hi < 0L) {
+			q2add(x, &xn, &t1);
+			q2shr(&t1, &xn, (long)i);
+			q2add(y, y, &t1);
+			q2sub(z, z, &athtb[k]);
+		} else {
+			q2sub(x, &xn, &t1);
+			q2shr(&t1, &xn, (long)i);
+			q2sub(y, y, &t1);
+			q2add(z, z, &athtb[k]);
+		}
+		if (i == rep) rep = 3 * rep + 1;
+		else i++;
+	}
+}
+#endif
+
+// sin and cos of the Q2.62 angle z in [0, pi/4]; z is used up
+static void crdz(z, sp, cp)
+q2d *z;
+spf *sp;
+spf *cp;
+{
+	q2d x;
+	q2d y;
+
+	x.hi = 0x26DD3B6AL;
+	x.lo = 0x10D7969AL;
+	y.hi = 0x00000000L;
+	y.lo = 0x00000000L;
+	q2rot(&x, &y, z, (long)NCORD);
+	*cp = q2d_fp(&x);
+	*sp = q2d_fp(&y);
+}
+
+void cord8(a, sp, cp)
+spf a;
+spf *sp;
+spf *cp;
+{
+	q2d z;
+
+	fpq2d(&z, a);
+	crdz(&z, sp, cp);
+}
 
 // map base (s0,c0) from first-octant back to full angle using oct
 static void octmap(ps, pc, s0, c0, oct)
@@ -484,84 +594,153 @@ spf *pc;
 }
 
 // ------------- public trig -------------
-spf spfsin(a)
+// sin and cos together: one octred, one CORDIC (or scpoly) pass
+void spfsc(a, sp, cp)
 spf a;
+spf *sp;
+spf *cp;
 {
 	spf ang;
-	spf s0;
-	spf c0;
 	spf s;
 	spf c;
 	long oct;
 
-	if(!cord_ok) cordin();
 	ang = octred(a, &oct);
-	if (locksp(ang, oct, &s0, &c0)) return s0;
+	if (locksp(ang, oct, sp, cp)) return;
+#ifdef SCPOLY
+	scpoly(ang, &s, &c);
+#else
 	cord8(ang, &s, &c);
-	octmap(&s0, &c0, s, c, oct);
-	return s0;
+#endif
+	octmap(sp, cp, s, c, oct);
 }
 
-// -------- spfcos using octred then lock --------
-spf spfcos(a)
+// sin and cos to a chosen number of CORDIC steps n (SPFTLO,
+// SPFTMD, SPFTHI in spflib.h).  Below NCORD the steps run in
+// Q2.30 (q1rot); n >= NCORD is spfsc.
+void spfsct(a, sp, cp, n)
 spf a;
+spf *sp;
+spf *cp;
+long n;
 {
 	spf ang;
-	spf s0;
-	spf c0;
-	spf s;
-	spf c;
+	q2f x;
+	q2f y;
+	q2f z;
 	long oct;
 
-	if(!cord_ok) cordin();
+	if (n >= (long)NCORD) {
+		spfsc(a, sp, cp);
+		return;
+	}
 	ang = octred(a, &oct);
-	if (locksp(ang, oct, &s0, &c0)) return c0;
-	cord8(ang, &s, &c);
-	octmap(&s0, &c0, s, c, oct);
-	return c0;
+	if (locksp(ang, oct, sp, cp)) return;
+	z = fp_q2(ang);
+	x = 0x26DD3B6AL;	// 1/K in Q2.30
+	y = 0L;
+	q1rot(&x, &y, &z, n);
+	octmap(sp, cp, q2_fp(y), q2_fp(x), oct);
 }
 
-// -------- spftan using octred then lock (plus pole guard) --------
-spf spftan(a)
+spf spfsin(a)
 spf a;
 {
-	spf ang;
-	spf s0;
-	spf c0;
 	spf s;
 	spf c;
-	spf ac;
-	long oct;
 
-	if(!cord_ok) cordin();
-	ang = octred(a, &oct);
-	if (locksp(ang, oct, &s0, &c0)) {
-		if (spfeq(c0, spfz)) return (spfsgn(s0) > 0L) ? SPFPINF : SPFNINF;
-		return spfdiv(s0, c0);
+	spfsc(a, &s, &c);
+	return s;
+}
+
+spf spfcos(a)
+spf a;
+{
+	spf s;
+	spf c;
+
+	spfsc(a, &s, &c);
+	return c;
+}
+
+// ------------- unchecked entry points -------------
+// For callers that already hold the reduced angle: a must be in
+// [0, pi/4].  No octred, locksp or octmap, and no NaN or range
+// checks; the kernel runs on a as given.  Away from the locks the
+// results are spfsc's bit for bit.  Build with CHKPRE to have
+// each call check its precondition, report and return NaN.
+//#define CHKPRE 1
+#define C_PI4	0x3F490FDBL	// pi/4, the largest reduced angle
+
+void spfscu(a, sp, cp)
+spf a;
+spf *sp;
+spf *cp;
+{
+#ifdef CHKPRE
+	if ((unsigned long)a > (unsigned long)C_PI4) {
+		printf("spfscu: 0x%08lX not in [0, pi/4]\n", (unsigned long)a);
+		*sp = spfNAN;
+		*cp = spfNAN;
+		return;
 	}
+#endif
+#ifdef SCPOLY
+	scpoly(a, sp, cp);
+#else
+	cord8(a, sp, cp);
+#endif
+}
 
-	cord8(ang, &s, &c);
-	octmap(&s0, &c0, s, c, oct);
-	ac = spfabs(c0);
+spf spfsnu(a)
+spf a;
+{
+	spf s;
+	spf c;
+
+	spfscu(a, &s, &c);
+	return s;
+}
+
+spf spfcsu(a)
+spf a;
+{
+	spf s;
+	spf c;
+
+	spfscu(a, &s, &c);
+	return c;
+}
+
+// -------- spftan from one spfsc pass (plus pole guard) --------
+spf spftan(a)
+spf a;
+{
+	spf s;
+	spf c;
+	spf ac;
+	long sgn;
+
+	spfsc(a, &s, &c);
+	if (spfeq(c, spfz)) return (spfsgn(s) > 0L) ? SPFPINF : SPFNINF;
+	ac = spfabs(c);
 	if (spfcmp(ac, TANEPS) <= 0L) {
-		long sgn;
-		sgn = spfsgn(s0) * spfsgn(c0);
+		sgn = spfsgn(s) * spfsgn(c);
 		return (sgn > 0L) ? SPFPINF : SPFNINF;
 	}
-	return spfdiv(s0, c0);
+	return spfdiv(s, c);
 }
 
 // ---- tangent, cotangent, secant, cosecant (SPF domain) ----
 
-// cot(x) = cos(x)/sin(x)
+// cot(x) = cos(x)/sin(x), one spfsc pass
 spf spfcot(a)
 spf a;
 {
 	spf s;
 	spf c;
 	long sign;
-	s = spfsin(a);
-	c = spfcos(a);
+	spfsc(a, &s, &c);
 	// if |s| < EPSTINY -> +/-inf with correct sign
 	if (spfcmp(s, EPSTINY) < 0 && spfcmp(s, spfneg(EPSTINY)) > 0) {
 		sign = spfsgn(c) * spfsgn(s);
@@ -580,7 +759,7 @@ spf a;
 	if (spfcmp(c, EPSTINY) < 0 && spfcmp(c, spfneg(EPSTINY)) > 0) {
 		return (spfsgn(c) < 0) ? SPFNINF : SPFPINF;
 	}
-	return spfdiv(SPFONE, c);
+	return spfrcp(c);
 }
 
 // csc(x) = 1/sin(x)
@@ -593,6 +772,320 @@ spf a;
 	if (spfcmp(s, EPSTINY) < 0 && spfcmp(s, spfneg(EPSTINY)) > 0) {
 		return (spfsgn(s) < 0) ? SPFNINF : SPFPINF;
 	}
-	return spfdiv(SPFONE, s);
+	return spfrcp(s);
+}
+
+// ------------- degrees, half turns and binary angles -------------
+// Each octant is pi/4 whatever the unit, so these reduce by
+// integer work on the input's bits: the octant and the offset
+// into it are exact, and only the offset times the unit (pi/4 or
+// pi/180) rounds, once, in spx.  0, pi/6 and pi/4 into an octant
+// are caught exactly, so sin 180 deg = 0 and cospi(1/2) = 0.
+// The CORDIC build hands the angle to q2rot in Q2.62 with no
+// spf step; with SCPOLY it is rounded once for scpoly.
+#define CPI4M	0xC90FDAA2L	// pi/4 as spx: man, expo -1
+#define CPI4E	(-1)
+#define CDRM	0x8EFA3513L	// pi/180 as spx: man, expo -6
+#define CDRE	(-6)
+
+// sin and cos of octant oct plus n * 2^-k units of cm * 2^(ce-31)
+// in from its start.  full is the octant in the same units, or
+// 0 when n is known to be less and oct is even.
+static void bsc(n, k, full, oct, cm, ce, sp, cp)
+long n;
+long k;
+long full;
+long oct;
+long cm;
+int ce;
+spf *sp;
+spf *cp;
+{
+	spx u;
+	spx c;
+	spf s0;
+	spf c0;
+	q2d z;
+
+	oct &= 7L;
+	if (oct & 1L) n = full - n;
+	if (n == 0L) {
+		s0 = spfz;
+		c0 = spfone;
+	} else if (n == full) {
+		s0 = (spf)SPF_RT2_2;
+		c0 = (spf)SPF_RT2_2;
+	} else if (n * 3L == full * 2L) {
+		s0 = spfhlf;
+		c0 = (spf)SPF_RT3_2;
+	} else {
+		u.sign = 0;
+		u.expo = (int)(31L - k);
+		while (n > 0L) {
+			n <<= 1;
+			u.expo--;
+		}
+		u.man = n;
+		c.sign = 0;
+		c.expo = ce;
+		c.man = cm;
+		spxmul(&u, &u, &c);
+		if (u.expo < -12) {
+			// below 2^-12: sin = angle, cos = 1 after rounding
+			s0 = spx_fp(&u);
+			c0 = spfone;
+		} else {
+#ifdef SCPOLY
+			scpoly(spx_fp(&u), &s0, &c0);
+#else
+			// man * 2^(expo-31) as hi:lo * 2^-62
+			z.hi = (long)((unsigned long)u.man >> 1);
+			z.lo = u.man << 31;
+			if (u.expo < 0) q2shr(&z, &z, (long)-u.expo);
+			crdz(&z, &s0, &c0);
+#endif
+		}
+	}
+	octmap(sp, cp, s0, c0, oct);
+}
+
+// binary angle: b in 2^-32 of a turn, so a 16-bit encoder count
+// is b = count << 16; the octant is the top three bits
+void spfbsc(b, sp, cp)
+long b;
+spf *sp;
+spf *cp;
+{
+	unsigned long ub;
+
+	ub = (unsigned long)b;
+	bsc((long)(ub & 0x1FFFFFFFL), 29L, 0x20000000L,
+		(long)(ub >> 29), CPI4M, CPI4E, sp, cp);
+}
+
+// sin and cos of pi x: x = m * 2^-k half turns is 4m * 2^-k
+// octants, the octant in the bits of m above 2^k
+void spfpsc(x, sp, cp)
+spf x;
+spf *sp;
+spf *cp;
+{
+	long m;
+	long k;
+	long e;
+
+	e = (x >> 23) & 0xFFL;
+	if (e == 0xFFL) {
+		*sp = spfNAN;
+		*cp = spfNAN;
+		return;
+	}
+	m = (x & 0x007FFFFFL) | 0x00800000L;
+	if (e == 0L) m = 0L;
+	k = 148L - e;
+	if (k <= -3L)
+		bsc(0L, 0L, 1L, 0L, CPI4M, CPI4E, sp, cp);
+	else if (k <= 0L)
+		bsc(0L, 0L, 1L, m << -k, CPI4M, CPI4E, sp, cp);
+	else if (k < 24L)
+		bsc(m & ((1L << k) - 1L), k, 1L << k, m >> k,
+			CPI4M, CPI4E, sp, cp);
+	else
+		bsc(m, k, 0L, 0L, CPI4M, CPI4E, sp, cp);
+	if (x < 0L) *sp = spfneg(*sp);
+}
+
+// sin and cos of d degrees: d = m * 2^-k is taken mod 360 in
+// integers, the octant is the whole part over 45 and the rest,
+// with the fraction bits, is the offset
+void spfdsc(d, sp, cp)
+spf d;
+spf *sp;
+spf *cp;
+{
+	long m;
+	long k;
+	long e;
+	long i;
+
+	e = (d >> 23) & 0xFFL;
+	if (e == 0xFFL) {
+		*sp = spfNAN;
+		*cp = spfNAN;
+		return;
+	}
+	m = (d & 0x007FFFFFL) | 0x00800000L;
+	if (e == 0L) m = 0L;
+	k = 150L - e;
+	if (k <= 0L) {
+		i = m % 360L;
+		for (; k < 0L; k++) i = (i << 1) % 360L;
+		bsc(i % 45L, 0L, 45L, i / 45L, CDRM, CDRE, sp, cp);
+	} else if (k < 24L) {
+		i = (m >> k) % 360L;
+		bsc(((i % 45L) << k) + (m & ((1L << k) - 1L)), k, 45L << k,
+			i / 45L, CDRM, CDRE, sp, cp);
+	} else
+		bsc(m, k, 0L, 0L, CDRM, CDRE, sp, cp);
+	if (d < 0L) *sp = spfneg(*sp);
+}
+
+spf spfsnd(d)
+spf d;
+{
+	spf s;
+	spf c;
+
+	spfdsc(d, &s, &c);
+	return s;
+}
+
+spf spfcsd(d)
+spf d;
+{
+	spf s;
+	spf c;
+
+	spfdsc(d, &s, &c);
+	return c;
+}
+
+spf spfspi(x)
+spf x;
+{
+	spf s;
+	spf c;
+
+	spfpsc(x, &s, &c);
+	return s;
+}
+
+spf spfcpi(x)
+spf x;
+{
+	spf s;
+	spf c;
+
+	spfpsc(x, &s, &c);
+	return c;
+}
+
+// ------------- arrays and the phase oscillator -------------
+// s[i] and c[i] = sin and cos of a[i], n elements, the spfsc
+// steps run inline.  Each a[i] still gets its own reduction, so
+// only the call per element is saved; for equally spaced angles
+// use spfosi and spfosn.  Either s or c may be 0 when only the
+// other is wanted; s or c may be a.
+void spvsc(s, c, a, n)
+spf *s;
+spf *c;
+spf *a;
+long n;
+{
+	spf ang;
+	spf s0;
+	spf c0;
+	spf so;
+	spf co;
+	long oct;
+	long i;
+
+	for (i = 0L; i < n; i++) {
+		ang = octred(a[i], &oct);
+		if (!locksp(ang, oct, &so, &co)) {
+#ifdef SCPOLY
+			scpoly(ang, &s0, &c0);
+#else
+			cord8(ang, &s0, &c0);
+#endif
+			octmap(&so, &co, s0, c0, oct);
+		}
+		if (s) s[i] = so;
+		if (c) c[i] = co;
+	}
+}
+
+void spvsin(r, a, n)
+spf *r;
+spf *a;
+long n;
+{
+	spvsc(r, (spf *)0L, a, n);
+}
+
+void spvcos(r, a, n)
+spf *r;
+spf *a;
+long n;
+{
+	spvsc((spf *)0L, r, a, n);
+}
+
+// exp coefficients 1/k!, k = 0..10, as spx, spftbl.s (mktbl.c)
+extern spx exptb[];
+
+// spx -> Q2.30, rounded; |x| < 2
+static q2f spxq2(x)
+spx *x;
+{
+	unsigned long m;
+	long sh;
+
+	sh = 1L - (long)x->expo;
+	if (x->man == 0L || sh > 32L) return 0L;
+	m = (unsigned long)x->man >> (sh - 1L);
+	m = (m + 1L) >> 1;
+	return (x->sign) ? -(long)m : (long)m;
 }
 
+// Set up o for sin and cos of a, a + da, a + 2 da, ... from
+// spfosn (spfosc.s).  The step's sin and cos are worked out in
+// spx, good to Q2.30 for |da| < 4, rather than by spfsc, whose
+// 24-bit results let the phase drift about 10 times faster: da
+// is halved below 1/2, put through the Taylor series and
+// doubled back.
+void spfosi(o, a, da)
+SPFOSC *o;
+spf a;
+spf da;
+{
+	spf s;
+	spf c;
+	spx d;
+	spx x;
+	spx sd;
+	spx cd;
+	spx one;
+	int i;
+	int m;
+
+	spfsc(a, &s, &c);
+	o->c = fp_q2(c);
+	o->s = fp_q2(s);
+	o->n = OSCRN;
+	fpspx(&d, da);
+	for (m = 0; d.man != 0L && d.expo >= -1; m++)
+		d.expo--;
+	// x = -d^2; sin d = d (1/1! + x/3! + ... + x^4/9!),
+	// cos d = 1/0! + x/2! + ... + x^5/10!
+	spxmul(&x, &d, &d);
+	x.sign = -1;
+	spxfma(&sd, &x, &exptb[9], &exptb[7]);
+	for (i = 5; i >= 1; i -= 2)
+		spxfma(&sd, &x, &sd, &exptb[i]);
+	spxmul(&sd, &sd, &d);
+	spxfma(&cd, &x, &exptb[10], &exptb[8]);
+	for (i = 6; i >= 0; i -= 2)
+		spxfma(&cd, &x, &cd, &exptb[i]);
+	// sin 2d = 2 sin d cos d, cos 2d = 1 - 2 sin^2 d
+	fpspx(&one, spfone);
+	for (; m > 0; m--) {
+		spxmul(&x, &sd, &sd);
+		if (x.man != 0L) x.expo++;
+		spxmul(&sd, &sd, &cd);
+		if (sd.man != 0L) sd.expo++;
+		spxsub(&cd, &one, &x);
+	}
+	o->sd = spxq2(&sd);
+	o->cd = spxq2(&cd);
+}
@@ -29,14 +29,16 @@
 #define EPSATN		0x00000001L
 #define EPSTINY		0x33800000L	// 2^-24, pole guard
 
-// External CORDIC atan table in Q2.62 (26 steps expected)
-q2d cordtb[26];
+// CORDIC atan(2^-i) table and pi/2 in Q2.62, spftbl.s (mktbl.c)
+extern q2d atntb[];
+extern q2d q2pi2;
 
 // q2 helpers: prototypes (pointer-out, void return)
 void q2asgn();
 void q2add();
 void q2neg();
 void q2sub();
+void q2shr();
 long q2cmp();
 void q2dbg();
 
@@ -67,147 +69,47 @@ WORD n;
 }
 
 #define N_ATN 32
-static q2d atntbl[N_ATN];
-static long atn_ok = 0;
-static q2d pi;
-static q2d pi2;
-static q2d pi2x;
+#define TAN_30 0x3F13CD3AL	// tan(30 deg)
 
-// Q2.62 arctan table setup for CORDIC (i = 0..25), split into 32-bit hi/lo.
-// Requires: atntbl[] is q2d (with .hi and .lo members), and atn_ok global.
-void q2atni()
-{
-WORD	i;
-
-	pi2.hi = 0x6487ED51L;
-	pi2.lo = 0x10B4611AL;
-	pi.hi = 0xC90FDAA2L;
-	pi.lo = 0x9FDE7B4CL;
-	pi2x.hi = 0x921FB544L;
-	pi2x.lo = 0x13DEFA96L;
-	
-// CORDIC vectoring table: z_i = atan(2^-i), i = 0..31 (Q2.62)
-atntbl[0].hi = 0x3243F6A8L;  // atan(2^-0) hi
-atntbl[0].lo = 0x885A308DL;  // atan(2^-0) lo
-
-atntbl[1].hi = 0x1DAC6705L;  // atan(2^-1) hi
-atntbl[1].lo = 0x91BBCC8AL;  // atan(2^-1) lo
-
-atntbl[2].hi = 0x0FADBAFCL;  // atan(2^-2) hi
-atntbl[2].lo = 0xB83747C8L;  // atan(2^-2) lo
-
-atntbl[3].hi = 0x07F56EA6L;  // atan(2^-3) hi
-atntbl[3].lo = 0x4C4B6030L;  // atan(2^-3) lo
-
-atntbl[4].hi = 0x03FEAB76L;  // atan(2^-4) hi
-atntbl[4].lo = 0x57EB503BL;  // atan(2^-4) lo
-
-atntbl[5].hi = 0x01FFD55BL;  // atan(2^-5) hi
-atntbl[5].lo = 0xBA3762A2L;  // atan(2^-5) lo
-
-atntbl[6].hi = 0x00FFFAABL;  // atan(2^-6) hi
-atntbl[6].lo = 0x98A2C7C6L;  // atan(2^-6) lo
-
-atntbl[7].hi = 0x007FFF55L;  // atan(2^-7) hi
-atntbl[7].lo = 0x54A39398L;  // atan(2^-7) lo
-
-atntbl[8].hi = 0x003FFFEAL;  // atan(2^-8) hi
-atntbl[8].lo = 0xAAAE2302L;  // atan(2^-8) lo
-
-atntbl[9].hi = 0x001FFFFCL;  // atan(2^-9) hi
-atntbl[9].lo = 0xAAAAA96FL;  // atan(2^-9) lo
-
-atntbl[10].hi = 0x000FFFFFL;  // atan(2^-10) hi
-atntbl[10].lo = 0xAAAAADDDL;  // atan(2^-10) lo
-
-atntbl[11].hi = 0x0007FFFFL;  // atan(2^-11) hi
-atntbl[11].lo = 0xFFFF5555L;  // atan(2^-11) lo
-
-atntbl[12].hi = 0x0003FFFFL;  // atan(2^-12) hi
-atntbl[12].lo = 0xFFFFFEAAL;  // atan(2^-12) lo
-
-atntbl[13].hi = 0x0001FFFFL;  // atan(2^-13) hi
-atntbl[13].lo = 0xFFFFFFF9L;  // atan(2^-13) lo
-
-atntbl[14].hi = 0x0000FFFFL;  // atan(2^-14) hi
-atntbl[14].lo = 0xFFFFFFFEL;  // atan(2^-14) lo
-
-atntbl[15].hi = 0x00007FFFL;  // atan(2^-15) hi
-atntbl[15].lo = 0xFFFFFFFFL;  // atan(2^-15) lo
-
-atntbl[16].hi = 0x00003FFFL;  // atan(2^-16) hi
-atntbl[16].lo = 0xFFFFFFFFL;  // atan(2^-16) lo
-
-atntbl[17].hi = 0x00001FFFL;  // atan(2^-17) hi
-atntbl[17].lo = 0xFFFFFFFFL;  // atan(2^-17) lo
-
-atntbl[18].hi = 0x00000FFFL;  // atan(2^-18) hi
-atntbl[18].lo = 0xFFFFFFFFL;  // atan(2^-18) lo
-
-atntbl[19].hi = 0x000007FFL;  // atan(2^-19) hi
-atntbl[19].lo = 0xFFFFFFFFL;  // atan(2^-19) lo
-
-atntbl[20].hi = 0x000003FFL;  // atan(2^-20) hi
-atntbl[20].lo = 0xFFFFFFFFL;  // atan(2^-20) lo
-
-atntbl[21].hi = 0x000001FFL;  // atan(2^-21) hi
-atntbl[21].lo = 0xFFFFFFFFL;  // atan(2^-21) lo
+// vectoring steps in Q2.30, the angle in Q2.30 or Q2.62 (spfcrd.s)
+void q1vec();
+void q1vecd();
 
-atntbl[22].hi = 0x000000FFL;  // atan(2^-22) hi
-atntbl[22].lo = 0xFFFFFFFFL;  // atan(2^-22) lo
+// ATPOLY: spfatn from the table and polynomial kernel atpoly
+// (spfscp.s) instead of CORDIC vectoring.  Faster, and within
+// 0.51 ulp where the CORDIC result is off by up to 32 ulp; see
+// the spfscp.s header for the numbers.
+//#define ATPOLY 1
+spf atpoly();
 
-atntbl[23].hi = 0x0000007FL;  // atan(2^-23) hi
-atntbl[23].lo = 0xFFFFFFFFL;  // atan(2^-23) lo
-
-atntbl[24].hi = 0x0000003FL;  // atan(2^-24) hi
-atntbl[24].lo = 0xFFFFFFFFL;  // atan(2^-24) lo
-
-atntbl[25].hi = 0x0000001FL;  // atan(2^-25) hi
-atntbl[25].lo = 0xFFFFFFFFL;  // atan(2^-25) lo
-
-atntbl[26].hi = 0x0000000FL;  // atan(2^-26) hi
-atntbl[26].lo = 0xFFFFFFFFL;  // atan(2^-26) lo
-
-atntbl[27].hi = 0x00000007L;  // atan(2^-27) hi
-atntbl[27].lo = 0xFFFFFFFFL;  // atan(2^-27) lo
-
-atntbl[28].hi = 0x00000003L;  // atan(2^-28) hi
-atntbl[28].lo = 0xFFFFFFFFL;  // atan(2^-28) lo
-
-atntbl[29].hi = 0x00000001L;  // atan(2^-29) hi
-atntbl[29].lo = 0xFFFFFFFFL;  // atan(2^-29) lo
-
-atntbl[30].hi = 0x00000000L;  // atan(2^-30) hi
-atntbl[30].lo = 0xFFFFFFFFL;  // atan(2^-30) lo
-
-atntbl[31].hi = 0x00000000L;  // atan(2^-31) hi
-atntbl[31].lo = 0x7FFFFFFFL;  // atan(2^-31) lo
-
-	atn_ok = 1;
-	
-#ifdef DEBUG	
-	printf("i____atntbl.hi atntbl.lo\n");
-	
-	for(i=0;i<32;i++) {
-	   printf("%3d   %08lX  %08lX\n",i,atntbl[i].hi,atntbl[i].lo);
-	}
+// arctangent via CORDIC vectoring mode in q2.30
+spf spfatn(a)
+spf a;
+{
+#ifdef ATPOLY
+        if (spfeq(a, spfz)) return spfz;
+        if (spflt(a, spfz)) return spfneg(atpoly(spfneg(a)));
+        return atpoly(a);
+#else
+        return spfatt(a, (long)N_ATN);
 #endif
 }
 
-// arctangent via CORDIC vectoring mode in q2.30
-spf spfatn(a)
+// arctangent to n CORDIC steps (SPFTLO, SPFTMD, SPFTHI in
+// spflib.h).  Below SPFTHI the angle is summed in Q2.30 by
+// q1vec; from there on in Q2.62 by q1vecd, as spfatn always has.
+spf spfatt(a, n)
 spf a;
+long n;
 {
         q2d z;
+        q2f zs;
         q2f x;
         q2f y;
-        q2f xi;
-        long i;
         long neg;
         long swp;
 
         if (spfeq(a, spfz)) return spfz;
-        if (!atn_ok) q2atni();
 
         /* record sign and work on |a| */
         neg = 0L;
@@ -237,26 +139,21 @@ spf a;
         }
 
 
+        if (n < SPFTHI) {
+                zs = 0L;
+                q1vec(&x, &y, &zs, n);
+                if (swp) zs = q2pi2.hi - zs;
+                if (neg) zs = -zs;
+                return q2_fp(zs);
+        }
+
         z.hi = 0L;
         z.lo = 0L;
-
-        for (i = 0L; i < N_ATN; ++i) {
-                if (y >  0L) {
-                        xi = x;
-                        x  = x + sra(y, (WORD)i);
-                        y  = y - sra(xi, (WORD)i);
-                        q2add(&z, &z, &atntbl[i]);
-                } else {
-                        xi = x;
-                        x  = x - sra(y, (WORD)i);
-                        y  = y + sra(xi, (WORD)i);
-                        q2sub(&z, &z, &atntbl[i]);
-                }
-        }
+        q1vecd(&x, &y, &z, (long)N_ATN);
 
         if (swp) {
                 /* z = pi/2 - z  (since we used 1/a) */
-                q2sub(&z, &pi2, &z);
+                q2sub(&z, &q2pi2, &z);
         }
 
         if (neg) q2neg(&z, &z);
@@ -264,6 +161,117 @@ spf a;
         return q2d_fp(&z);
 }
 
+// Hyperbolic CORDIC: x = k ln2 + r, |r| <= ln2/2 (lnred, spfefn.c),
+// then NHYR rotation steps from (1/K, 0) turn through r and leave
+// cosh r and sinh r in Q2.62, with the angle still to go, under
+// atanh(2^-16), in z.  That is folded in as c + s z and s + c z in
+// spx (first order, off by z^2/2 < 2^-33), cheaper than the 16
+// more steps it replaces.  e^r = c + s, e^-r = c - s, and 2^k goes
+// into the spx exponents, so each result is rounded once.
+#define NHYR	18		// q2hyp steps, as q2hki in mktbl.c
+extern q2d q2hki;
+long lnred();
+void q2hyp();
+static void q2spx();
+
+// spx a, |a| < 1, to Q2.62, truncated
+static void spxq2d(z, a)
+q2d *z;
+spx *a;
+{
+        q2d t;
+
+        if (a->man == 0L) {
+                z->hi = 0L;
+                z->lo = 0L;
+                return;
+        }
+        t.hi = (long)((unsigned long)a->man >> 1);
+        t.lo = a->man << 31;
+        q2shr(z, &t, (long)(-a->expo));
+        if (a->sign) q2neg(z, z);
+}
+
+// hycrd — cosh r and sinh r in spx for x = k ln2 + r; returns k
+static long hycrd(x, cp, sp)
+spf x;
+spx *cp;
+spx *sp;
+{
+        spx r;
+        spx w;
+        q2d cx;
+        q2d sy;
+        q2d z;
+        long k;
+
+        k = lnred(&r, x);
+        spxq2d(&z, &r);
+        q2asgn(&cx, &q2hki);
+        sy.hi = 0L;
+        sy.lo = 0L;
+        q2hyp(&cx, &sy, &z, (long)NHYR);
+        q2spx(cp, &cx);
+        q2spx(sp, &sy);
+        q2spx(&w, &z);
+        spxfma(&r, sp, &w, cp);
+        spxfma(sp, cp, &w, sp);
+        cp->sign = r.sign;
+        cp->expo = r.expo;
+        cp->man = r.man;
+        return k;
+}
+
+// hyshc — sinh and cosh of a, 0 <= a < SPFEXB:
+// cosh = 2^(k-1) e^r + 2^(-k-1) e^-r, sinh the difference
+static void hyshc(a, ps, pc)
+spf a;
+spf *ps;
+spf *pc;
+{
+        spx c;
+        spx s;
+        spx ep;
+        spx em;
+        long k;
+
+        k = hycrd(a, &c, &s);
+        if (k != 0L) {
+                spxadd(&ep, &c, &s);
+                spxsub(&em, &c, &s);
+                ep.expo += (int)(k - 1L);
+                em.expo -= (int)(k + 1L);
+                spxadd(&c, &ep, &em);
+                spxsub(&s, &ep, &em);
+        }
+        *pc = spx_fp(&c);
+        *ps = spx_fp(&s);
+}
+
+// spfexh — e^x as cosh r + sinh r from the same CORDIC pass
+spf spfexh(x)
+spf x;
+{
+        spx c;
+        spx s;
+        long k;
+
+        if ((x & 0x7FFFFFFFL) > SPFPINF) return x;		// NaN
+        if ((x & 0x7FFFFFFFL) >= SPFEXB) {
+                // past spf as spx_fp would have it; +-inf are exact
+                if (x < 0L) {
+                        if (x != SPFNINF) spfrse(SPFUNF | SPFINX);
+                        return spfz;
+                }
+                if (x != SPFPINF) spfrse(SPFOVF | SPFINX);
+                return SPFPINF;
+        }
+        k = hycrd(x, &c, &s);
+        spxadd(&c, &c, &s);
+        c.expo += (int)k;
+        return spx_fp(&c);
+}
+
 #define TINY	0x3e000000L	// 0.125
 #define C_1_2	0x3f000000L
 #define C_1_6	0x3e2aaaabL
@@ -279,36 +287,25 @@ spf *pc;
 	spf a;
 	spf s;
 	spf c;
-	spf e;
-	spf ei;
 	spf t;
 	spf x2;
-	spf x3;
-	spf x4;
-	spf x5;
 	a = spfabs(x);
 	if (a < (spf)TINY) {
+		/* c = 1 + x2(1/2 + x2/24), s = a + a*x2(1/6 + x2/120) */
 		x2 = spfmul(a, a);
-		x3 = spfmul(x2, a);
-		x4 = spfmul(x2, x2);
-		x5 = spfmul(x3, x2);
-		c = spfone;
-		t = spfmul(x2, (spf)C_1_2);
-		c = spfadd(c, t);
-		t = spfmul(x4, (spf)C_1_24);
-		c = spfadd(c, t);
+		t = spffma(x2, (spf)C_1_24, (spf)C_1_2);
+		c = spffma(x2, t, spfone);
+		t = spffma(x2, (spf)C_1_120, (spf)C_1_6);
+		s = spffma(spfmul(a, x2), t, a);
+	} else if (a > SPFPINF) {
 		s = a;
-		t = spfmul(x3, (spf)C_1_6);
-		s = spfadd(s, t);
-		t = spfmul(x5, (spf)C_1_120);
-		s = spfadd(s, t);
+		c = a;
+	} else if (a >= SPFEXB) {
+		if (a != SPFPINF) spfrse(SPFOVF | SPFINX);
+		s = SPFPINF;
+		c = SPFPINF;
 	} else {
-		e = spfexp(a);
-		ei = spfdiv(spfone, e);
-		s = spfsub(e, ei);
-		s = spfmul(s, spfhlf);
-		c = spfadd(e, ei);
-		c = spfmul(c, spfhlf);
+		hyshc(a, &s, &c);
 	}
 	if ((long)x < 0L) s = spfneg(s);
 	*ps = s;
@@ -324,9 +321,8 @@ spf *pc;
 	/* constants (IEEE-754 single in hex) */
 #define HLF     0x3F000000L  /* 0.5f */
 #define TSMALL  0x39800000L  /* ~2^-12: small-x threshold */
-#define TBIG    0x42B17218L  /* ~88.72: ln(FLT_MAX) */
 
-	spf ax, ex, rinv, s0, c0, x2, t;
+	spf ax, s0, c0, x2, t;
 	long neg;
 
 	ax  = spfabs(x);
@@ -336,29 +332,29 @@ spf *pc;
 	if (spfcmp(ax, TSMALL) <= 0L) {
 		x2 = spfmul(x, x);
 		/* cosh ≈ 1 + x^2/2 */
-		*pc = spfadd(spfone, spfmul(HLF, x2));
-		/* sinh ≈ x + x^3/6  (1/6 = 0x3D2AAAABL) */
-		t   = spfmul(x2, 0x3D2AAAABL);
-		*ps = spfadd(x, spfmul(x, t));
+		*pc = spffma(HLF, x2, spfone);
+		/* sinh ≈ x + x^3/6 */
+		t   = spfmul(x2, C_1_6);
+		*ps = spffma(x, t, x);
 		return;
 	}
 
-	/* normal range: two-exponent form with correct +/- */
-	if (spfcmp(ax, TBIG) < 0L) {
-		ex   = spfexp(ax);
-		rinv = spfdiv(spfone, ex);
-		c0   = spfmul(HLF, spfadd(ex, rinv)); /* ½(e^|x| + e^-|x|) */
-		s0   = spfmul(HLF, spfsub(ex, rinv)); /* ½(e^|x| − e^-|x|) */
-		if (neg) s0 = spfneg(s0);
-		*ps = s0;
-		*pc = c0;
+	/* NaN; past SPFEXB cosh and sinh overflow */
+	if (ax > SPFPINF) {
+		*ps = ax;
+		*pc = ax;
+		return;
+	}
+	if (spfcmp(ax, SPFEXB) >= 0L) {
+		if (ax != SPFPINF) spfrse(SPFOVF | SPFINX);
+		*ps = neg ? SPFNINF : SPFPINF;
+		*pc = SPFPINF;
 		return;
 	}
 
-	/* very large |x|: e^-|x| underflows ⇒ cosh ≈ ½ e^|x|, sinh ≈ ±cosh */
-	ex = spfexp(spfmul(ax, HLF));         /* e^{|x|/2} */
-	c0 = spfmul(HLF, spfmul(ex, ex));     /* ½ e^{|x|}  (via square) */
-	s0 = neg ? spfneg(c0) : c0;
+	/* hyperbolic CORDIC */
+	hyshc(ax, &s0, &c0);
+	if (neg) s0 = spfneg(s0);
 	*ps = s0;
 	*pc = c0;
 }
@@ -388,83 +384,607 @@ spf s,c;
 	return spfdiv(s,c); 
 }
 
-// asnh(x) = ln( x + sqrt(x*x + 1) )   (odd function)
-spf asnh(x)
-spf x;
+// Inverse hyperbolics by hyperbolic CORDIC vectoring (q2hvc): from
+// (X, Y) the steps drive Y to 0, leaving atanh(Y/X) in z and
+// K sqrt(X^2 - Y^2) in X.  ln(u/v) = 2 atanh((u-v)/(u+v)) gives the
+// logarithms with no divide, and (w + 1/4, w - 1/4) gives sqrt w as
+// the by-product, with no spfsqr.  NHYV steps leave z about 2^-30
+// off, so results under 1/8 come from the odd series instead.
+#define NHYV	33		// q2hvc steps for the angle, shift 31
+#define C_1_8	0x3e000000L	// 1/8: series below
+#define C_2_12	0x45800000L	// 2^12: sqrt(x^2 +/- 1) = x past it
+extern spx lg2cv[];		// ln2, log10(2) (spftbl.s)
+void q2hvc();
+
+// a + a t (c[0] + t (c[1] + ...)), t = a^2, |a| < 1/8
+static spf athcf[5] = {
+	0x3eaaaaabL, 0x3e4ccccdL, 0x3e124925L,	// 1/3, 1/5, 1/7
+	0x3de38e39L, 0x3dba2e8cL		// 1/9, 1/11
+};
+static spf ashcf[4] = {
+	0xbe2aaaabL, 0x3d99999aL,		// -1/6, 3/40
+	0xbd36db6eL, 0x3cf8e38eL		// -5/112, 35/1152
+};
+
+// oddser — r = the odd series with coefficients c[0..n-1] at a
+static void oddser(r, a, c, n)
+spx *r;
+spx *a;
+spf *c;
+int n;
 {
-    spf t, s;
+        spx t;
+        spx p;
+        spx k;
+        int i;
+
+        spxmul(&t, a, a);
+        fpspx(&p, c[n - 1]);
+        for (i = n - 2; i >= 0; i--) {
+                fpspx(&k, c[i]);
+                spxfma(&p, &p, &t, &k);
+        }
+        spxmul(&p, &p, &t);
+        spxfma(r, &p, a, a);
+}
 
-    if (spfeq(x, spfz)) return spfz;            // exact zero
+// hvln — r = ln(u/v) / 2, u, v > 0: the mantissas U, V in [1, 2)
+// go in as ((U+V)/4, (U-V)/4), |atanh| <= ln2/2, and the exponent
+// difference e adds e ln2 / 2
+static void hvln(r, u, v)
+spx *r;
+spx *u;
+spx *v;
+{
+        spx a;
+        q2d x;
+        q2d y;
+        q2d z;
+        long e;
+
+        e = (long)(u->expo - v->expo);
+        a.sign = 0;
+        a.expo = -2;
+        a.man = u->man;
+        spxq2d(&x, &a);
+        a.man = v->man;
+        spxq2d(&z, &a);
+        q2sub(&y, &x, &z);
+        q2add(&x, &x, &z);
+        z.hi = 0L;
+        z.lo = 0L;
+        q2hvc(&x, &y, &z, (long)NHYV);
+        q2spx(r, &z);
+        if (e != 0L) {
+                fpspx(&a, spfltf(e));
+                a.expo--;
+                spxfma(r, &a, &lg2cv[0], r);
+        }
+}
 
-    t = spfmul(x, x);                            // x*x
-    t = spfadd(t, spfone);                       // x*x + 1
-    s = spfsqr(t);                               // sqrt(x*x + 1)
-    return spfln(spfadd(x, s));                  // ln(x + sqrt(...))
+// hvsqr — r = sqrt w, w > 0: w' = w 4^-j in [1/2, 2), and
+// (w'/2 + 1/8, w'/2 - 1/8) ends at K sqrt(w') / 2 after the NHYR
+// steps of q2hki; the angle left over only costs its square
+static void hvsqr(r, w)
+spx *r;
+spx *w;
+{
+        spx a;
+        q2d x;
+        q2d y;
+        q2d z;
+        int j;
+
+        j = (w->expo + 1) >> 1;
+        a.sign = 0;
+        a.expo = w->expo - 2 * j - 1;
+        a.man = w->man;
+        spxq2d(&x, &a);
+        z.hi = 0x08000000L;		// 1/8
+        z.lo = 0L;
+        q2sub(&y, &x, &z);
+        q2add(&x, &x, &z);
+        z.hi = 0L;
+        q2hvc(&x, &y, &z, (long)NHYR);
+        q2spx(r, &x);
+        q2spx(&a, &q2hki);
+        spxmul(r, r, &a);
+        r->expo += j + 1;
 }
 
-// acnh(x) = ln( x + sqrt((x-1)*(x+1)) ),  domain x >= 1
-spf acnh(x)
-spf x;
+// hvlnp — r = ln(a + s), a, s >= 0, a + s >= 1
+static void hvlnp(r, a, s)
+spx *r;
+spx *a;
+spx *s;
 {
-    spf xm1, xp1, rad, s;
+        spx one;
+
+        one.sign = 0;
+        one.expo = 0;
+        one.man = 0x80000000L;
+        spxadd(r, a, s);
+        hvln(r, r, &one);
+        if (r->man != 0L) r->expo++;
+}
 
-    if (spflt(x, spfone)) return spfNAN;         // domain guard
+// asnh(x) = ln(|x| + sqrt(x^2 + 1)), odd
+spf asnh(x)
+spf x;
+{
+        spf a;
+        spx u;
+        spx w;
+        spx s;
+
+        a = spfabs(x);
+        if (a >= SPFPINF || a < 0x00800000L) return x;	// NaN, inf, 0
+        fpspx(&u, a);
+        if (a < C_1_8) {
+                oddser(&u, &u, ashcf, 4);
+        } else if (a >= C_2_12) {
+                hvlnp(&u, &u, &u);				// ln 2|x|
+        } else {
+                fpspx(&s, spfone);
+                spxfma(&w, &u, &u, &s);
+                hvsqr(&s, &w);
+                hvlnp(&u, &u, &s);
+        }
+        if ((long)x < 0L) u.sign = -1;
+        return spx_fp(&u);
+}
 
-    xm1 = spfsub(x, spfone);                     // x - 1
-    xp1 = spfadd(x, spfone);                     // x + 1
-    rad = spfmul(xm1, xp1);                      // (x-1)*(x+1) = x*x - 1
-    s   = spfsqr(rad);                           // sqrt(x*x - 1)
-    return spfln(spfadd(x, s));                  // ln(x + sqrt(...))
+// acnh(x) = ln(x + sqrt((x-1)(x+1))), x >= 1; asinh of the root
+// where that is under 1/8
+spf acnh(x)
+spf x;
+{
+        spx u;
+        spx w;
+        spx s;
+        spx t;
+
+        if (x > SPFPINF) return x;			// NaN
+        if (x < spfone) return spfNAN;			// domain guard
+        if (x == SPFPINF) return x;
+        fpspx(&u, x);
+        if (x >= C_2_12) {
+                hvlnp(&u, &u, &u);				// ln 2x
+                return spx_fp(&u);
+        }
+        fpspx(&t, spfone);
+        spxsub(&w, &u, &t);
+        if (w.man == 0L) return spfz;			// acosh 1
+        spxadd(&t, &u, &t);
+        spxmul(&w, &w, &t);
+        hvsqr(&s, &w);
+        if (s.expo < -3) {
+                oddser(&u, &s, ashcf, 4);
+        } else {
+                hvlnp(&u, &u, &s);
+        }
+        return spx_fp(&u);
 }
 
-// atnh(x) = 0.5 * ln( (1+x)/(1-x) ),  domain |x| < 1
+// atnh(x) = ln((1+x)/(1-x)) / 2, |x| < 1: 1 + |x| and 1 - |x| are
+// exact in spx and go to hvln as they are
 spf atnh(x)
 spf x;
 {
-    spf ax, num, den, q, l;
+        spf a;
+        spx u;
+        spx v;
+        spx t;
+
+        a = spfabs(x);
+        if (a >= spfone) return spfNAN;			// |x|>=1 out of domain
+        if (a < 0x00800000L) return x;			// 0
+        fpspx(&t, a);
+        if (a < C_1_8) {
+                oddser(&u, &t, athcf, 5);
+        } else {
+                fpspx(&u, spfone);
+                spxsub(&v, &u, &t);
+                spxadd(&u, &u, &t);
+                hvln(&u, &u, &v);
+        }
+        if ((long)x < 0L) u.sign = -1;
+        return spx_fp(&u);
+}
+
+
+#define SPXZE	(-16384)	// spx zero exponent (spfspx.s)
+
+// q2d -> spx, kept to 32 bits (value = hi:lo * 2^-62)
+static void q2spx(r, z)
+spx *r;
+q2d *z;
+{
+        q2d w;
+        long e;
+
+        r->sign = 0;
+        q2asgn(&w, z);
+        if (w.hi < 0L) {
+                q2neg(&w, &w);
+                r->sign = -1;
+        }
+        e = 1L;
+        if (w.hi == 0L) {
+                w.hi = w.lo;
+                w.lo = 0L;
+                e -= 32L;
+        }
+        if (w.hi == 0L) {
+                r->expo = SPXZE;
+                r->man = 0L;
+                return;
+        }
+        while (w.hi > 0L) {
+                w.hi = (w.hi << 1) | (long)((unsigned long)w.lo >> 31);
+                w.lo <<= 1;
+                e--;
+        }
+        r->expo = (int)e;
+        r->man = w.hi;
+}
 
-    ax = spfabs(x);
-    if (spfcmp(ax, spfone) >= 0L) return spfNAN; // |x|>=1 out of domain
+#define INVKM	0x9B74EDA8L	// 1/K in Q0.32 (CORDIC gain, 26+ steps)
 
-    num = spfadd(spfone, x);                     // 1 + x
-    den = spfsub(spfone, x);                     // 1 - x
-    q   = spfdiv(num, den);
-    l   = spfln(q);
-    return spfmul(spfhlf, l);                    // 0.5 * ln(...)
+// q2d z / K * 2^(e - 125) as spf, rounded once: the CORDIC output
+// back from the scale its input was put in (e is the larger biased
+// exponent of the input, whose mantissa sat in [1/4, 1/2))
+static spf q2unk(z, e)
+q2d *z;
+long e;
+{
+        spx u;
+        spx v;
+
+        q2spx(&u, z);
+        if (u.man == 0L) return spfz;
+        v.sign = 0;
+        v.expo = -1;
+        v.man = INVKM;
+        spxmul(&u, &u, &v);
+        u.expo += (int)(e - 125L);
+        return spx_fp(&u);
+}
+// ay / ax for 0 < ay < ax, both normal, by linear CORDIC vectoring:
+// y is driven to zero by subtracting x and z collects the powers of
+// two, one per step, in shifts and subtracts; rounded to nearest even
+static spf lincrd(ay, ax)
+spf ay;
+spf ax;
+{
+        long my;
+        long mx;
+        long z;
+        long e;
+        WORD i;
+
+        my = (ay & 0x007FFFFFL) | 0x00800000L;
+        mx = (ax & 0x007FFFFFL) | 0x00800000L;
+        e = (ay >> 23) - (ax >> 23) + 127L;
+        if (my < mx) {
+                my <<= 1;
+                e--;
+        }
+        if (e < 1L) {
+                spfrse(SPFUNF | SPFINX);
+                return spfz;
+        }
+        z = 0L;
+        for (i = 0; i < 25; i++) {
+                z <<= 1;
+                if (my >= mx) {
+                        my -= mx;
+                        z |= 1L;
+                }
+                my <<= 1;
+        }
+        // z holds 24 bits and a round bit; my != 0 is the sticky bit
+        if ((z & 1L) && (my != 0L || (z & 2L))) z += 2L;
+        if (my != 0L || (z & 1L)) spfrse(SPFINX);
+        return (e << 23) + (z >> 1) - 0x00800000L;
 }
 
+#define C_N1_3	0xbeaaaaabL
+#define C_1_5	0x3e4ccccdL
+#define C_N1_7	0xbe124925L
+#define C_1_9	0x3de38e39L
+#define C_N1_11	0xbdba2e8cL
+
+// spfpol: rectangular to polar in one CORDIC vectoring pass.
+// *pr = sqrt(x^2 + y^2), *pt = atan2(y, x) in [-pi, pi] with the
+// signs of zeros as in C.  |x| and |y| go to Q2.30 with the larger
+// in [1/4, 1/2), q1vecd turns (x, y) onto the x axis, and x / K
+// is the radius.  Q2.30 leaves the angle about 2^-27 off, too
+// coarse below 2^-2 (x > 0), so there atan(y/x) is a short series
+// on y/x from lincrd.  No division.
+void spfpol(x, y, pr, pt)
+spf x;
+spf y;
+spf *pr;
+spf *pt;
+{
+        spf ax;
+        spf ay;
+        spf r;
+        spf t;
+        spf t2;
+        spf r2;
+        q2f cx;
+        q2f cy;
+        q2d z;
+        q2d w;
+        spx u;
+        spx v;
+        long ex;
+        long ey;
+        long e;
+        long inf;
+
+        ax = spfabs(x);
+        ay = spfabs(y);
+        if (ax > SPFPINF || ay > SPFPINF) {
+                *pr = spfNAN;
+                *pt = spfNAN;
+                return;
+        }
+        // infinite: the angle of the direction it goes off in
+        inf = (ax == SPFPINF || ay == SPFPINF);
+        if (inf) {
+                ax = (ax == SPFPINF) ? SPFONE : spfz;
+                ay = (ay == SPFPINF) ? SPFONE : spfz;
+        }
+        ex = ax >> 23;
+        ey = ay >> 23;
+        if (ey == 0L) {
+                // on the x axis (denormals count as zero)
+                r = (ex == 0L) ? spfz : ax;
+                t = ((long)x < 0L) ? spfpi : spfz;
+        } else if (ex == 0L) {
+                r = ay;
+                t = spfpi2;
+        } else {
+                e = (ex > ey) ? ex : ey;
+                cx = (ex + 32L <= e) ? 0L :
+                        (((ax & 0x007FFFFFL) | 0x00800000L) << 5) >> (WORD)(e - ex);
+                cy = (ey + 32L <= e) ? 0L :
+                        (((ay & 0x007FFFFFL) | 0x00800000L) << 5) >> (WORD)(e - ey);
+                z.hi = 0L;
+                z.lo = 0L;
+                q1vecd(&cx, &cy, &z, (long)N_ATN);
+                w.hi = cx;
+                w.lo = 0L;
+                r = q2unk(&w, e);
+                if ((long)x >= 0L && ey + 3L <= ex) {
+                        // t = y/x < 2^-2: atan t = t - t^3/3 + ... - t^11/11
+                        t = lincrd(ay, ax);
+                        t2 = spfmul(t, t);
+                        r2 = spffma(t2, C_N1_11, C_1_9);
+                        r2 = spffma(t2, r2, C_N1_7);
+                        r2 = spffma(t2, r2, C_1_5);
+                        r2 = spffma(t2, r2, C_N1_3);
+                        t = spffma(spfmul(t, t2), r2, t);
+                } else if ((long)x >= 0L) {
+                        q2spx(&u, &z);
+                        t = spx_fp(&u);
+                } else {
+                        // pi - z = pi/2 + (pi/2 - z)
+                        q2sub(&w, &q2pi2, &z);
+                        q2spx(&u, &w);
+                        q2spx(&v, &q2pi2);
+                        spxadd(&u, &u, &v);
+                        t = spx_fp(&u);
+                }
+        }
+        if ((long)y < 0L) t = (spf)(t ^ 0x80000000L);	// -0 too
+        *pr = inf ? SPFPINF : r;
+        *pt = t;
+}
 
-// spfa2: atan2(y,x) — angle in [-pi, +pi]
+// spfa2: atan2(y,x) — angle in [-pi, +pi], from spfpol
 spf spfa2(y, x)
 spf y;
 spf x;
 {
-	spf z;
-	spf a;
-	spf r;
-	if ((long)x > 0L) {
-		z = spfdiv(y, x);
-		r = spfatn(z);
-		return r;
-	}
-	if ((long)x < 0L && !((long)y < 0L)) {
-		z = spfdiv(y, x);
-		a = spfatn(z);
-		r = spfadd(a, spfpi);
-		return r;
-	}
-	if ((long)x < 0L && (long)y < 0L) {
-		z = spfdiv(y, x);
-		a = spfatn(z);
-		r = spfsub(a, spfpi);
-		return r;
-	}
-	if ((long)x == 0L) {
-		if ((long)y > 0L) return spfpi2;
-		if ((long)y < 0L) return spfneg(spfpi2);
-		return 0L;
-	}
-	return 0L;
+        spf r;
+        spf t;
+
+        spfpol(x, y, &r, &t);
+        return t;
+}
+
+// r = +/-m * 2^(38 - d) as a Q2.62 q2d, m the 24-bit mantissa of v
+// (0 if v is zero or denormal): with d = 126 - exponent that is v
+// itself, exact for |v| < 1
+static void q2put(r, v, d)
+q2d *r;
+spf v;
+long d;
+{
+        unsigned long m;
+
+        r->hi = 0L;
+        r->lo = 0L;
+        if ((v & 0x7F800000L) == 0L || d >= 62L) return;
+        m = ((unsigned long)(v & 0x007FFFFFL) | 0x00800000L) << 6;
+        if (d >= 32L) {
+                r->lo = (long)(m >> (WORD)(d - 32L));
+        } else if (d > 0L) {
+                r->hi = (long)(m >> (WORD)d);
+                r->lo = (long)(m << (WORD)(32L - d));
+        } else {
+                r->hi = (long)m;
+        }
+        if (v < 0L) q2neg(r, r);
+}
+
+// rotation steps in Q2.62 (spfcrd.s) and the reducer (spfred.s)
+void q2rot();
+spf octred();
+
+#define N_ROT	28
+
+// spfrot: (xo, yo) = (x, y) turned by a radians.  octred takes a
+// to q quarter turns and +/- ang in [-pi/4, pi/4]; q2rot turns the
+// vector itself (Q2.62, larger component in [1/4, 1/2)) by ang and
+// the gain comes off once on the way out (q2unk).  Quarter turns
+// are swaps; a = 0 returns (x, y) as they are.
+void spfrot(x, y, a, pxo, pyo)
+spf x;
+spf y;
+spf a;
+spf *pxo;
+spf *pyo;
+{
+        spf ang;
+        spf xr;
+        spf yr;
+        q2d cx;
+        q2d cy;
+        q2d z;
+        long ex;
+        long ey;
+        long e;
+        long oct;
+        long q;
+
+        if (spfabs(x) >= SPFPINF || spfabs(y) >= SPFPINF ||
+            spfabs(a) >= SPFPINF) {
+                *pxo = spfNAN;
+                *pyo = spfNAN;
+                return;
+        }
+        ex = (x >> 23) & 0xFFL;
+        ey = (y >> 23) & 0xFFL;
+        if (ex == 0L && ey == 0L) {
+                *pxo = spfz;
+                *pyo = spfz;
+                return;
+        }
+        // a = q pi/2 + ang
+        ang = octred(a, &oct);
+        q = oct >> 1;
+        if (oct & 1L) {
+                q++;
+                ang = spfneg(ang);
+        }
+        if (spfeq(ang, spfz)) {
+                xr = x;
+                yr = y;
+        } else {
+                e = (ex > ey) ? ex : ey;
+                q2put(&cx, x, e - ex + 1L);
+                q2put(&cy, y, e - ey + 1L);
+                q2put(&z, ang, 126L - ((ang >> 23) & 0xFFL));
+                q2rot(&cx, &cy, &z, (long)N_ROT);
+                xr = q2unk(&cx, e);
+                yr = q2unk(&cy, e);
+        }
+        switch ((WORD)(q & 3L)) {
+        case 0:  *pxo = xr;          *pyo = yr;          break;
+        case 1:  *pxo = spfneg(yr);  *pyo = xr;          break;
+        case 2:  *pxo = spfneg(xr);  *pyo = spfneg(yr);  break;
+        default: *pxo = yr;          *pyo = spfneg(xr);  break;
+        }
+}
+
+// double-iteration arcsine steps (spfcrd.s)
+void q2asn();
+
+#define N_ASN	30
+#define C_3_40	0x3d99999aL
+#define C_5_112	0x3d36db6eL
+#define C_35_1152 0x3cf8e38eL
+
+// z = asin(ax) / 2 in Q2.62, ax in [0, 1], from n steps of q2asn:
+// (1/2, 0) turns twice by atan(2^-i) each step, towards the side
+// where y meets t; both grow by exactly 1 + 4^-i a step, so t
+// keeps pace with y = |v| sin(angle) and no divide or sqrt is
+// needed.  The angle is good to about 2^(2-n) absolute.
+static void asnk(z, ax, n)
+q2d *z;
+spf ax;
+long n;
+{
+        q2d cx;
+        q2d cy;
+        q2d t;
+
+        cx.hi = 0x20000000L;
+        cx.lo = 0L;
+        cy.hi = 0L;
+        cy.lo = 0L;
+        z->hi = 0L;
+        z->lo = 0L;
+        q2put(&t, ax, 127L - ((ax >> 23) & 0xFFL));
+        q2asn(&cx, &cy, z, &t, n);
+}
+
+// spfasn: asin(x) on the CORDIC tables, |x| <= 1.  Below 2^-3
+// the series through x^9; above, N_ASN double steps, within
+// 0.75 ulp.
+spf spfasn(x)
+spf x;
+{
+        spf ax;
+        spf u;
+        spf s;
+        q2d z;
+        spx v;
+        long e;
+
+        ax = spfabs(x);
+        if ((long)ax > SPFONE) return spfNAN;
+        e = (ax >> 23) & 0xFFL;
+        if (e < 104L) return x;
+        if (e < 124L) {
+                // x + x^3/6 + 3x^5/40 + 5x^7/112 + 35x^9/1152
+                u = spfmul(x, x);
+                s = spfmul(u, C_35_1152);
+                s = spfmul(u, spfadd(s, C_5_112));
+                s = spfmul(u, spfadd(s, C_3_40));
+                s = spfmul(u, spfadd(s, C_1_6));
+                return spffma(x, s, x);
+        }
+        asnk(&z, ax, (long)N_ASN);
+        q2spx(&v, &z);
+        v.expo++;
+        if ((long)x < 0L) v.sign = -1;
+        return spx_fp(&v);
+}
+
+// spfacs: acos(x) = pi/2 - asin(x), |x| <= 1, taken as
+// 2 (pi/4 -/+ z) in Q2.62 so nothing cancels.  Near x = 1 the
+// angle is small and the kernel runs about one more step for
+// every factor of 4 that 1 - x drops below 1/2.
+spf spfacs(x)
+spf x;
+{
+        spf ax;
+        q2d z;
+        q2d w;
+        spx v;
+        long n;
+
+        ax = spfabs(x);
+        if ((long)ax > SPFONE) return spfNAN;
+        if (x == SPFONE) return spfz;
+        n = (long)N_ASN;
+        if ((long)x > C_1_2) {
+                // 1 - x is exact here
+                n += (128L - ((spfsub(SPFONE, x) >> 23) & 0xFFL)) / 2L - 1L;
+        }
+        asnk(&z, ax, n);
+        q2shr(&w, &q2pi2, 1L);
+        if ((long)x < 0L) q2add(&w, &w, &z);
+        else q2sub(&w, &w, &z);
+        q2spx(&v, &w);
+        v.expo++;
+        return spx_fp(&v);
 }
 
 // spfhyp: hypot(a,b) = sqrt(a^2 + b^2) stably
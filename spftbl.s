@@ -0,0 +1,295 @@
+*-----------------------------------------------------------
+* Title      : spftbl.s
+*              constant tables for the floating point
+*              library, written by mktbl.c - do not edit
+*
+*   atntb  atan(2^-i), i = 0..31, Q2.62 (hi, lo)
+*   q2pi2  pi/2, Q2.62
+*   exptb  1/k!, k = 0..10, spx (sign, expo, man)
+*   lg2tb  c = round(4096/j)/128, -log2 c, j = 23..45, spx
+*   lg2pc  (-1)^(k+1) / (k ln2), k = 1..6, spx
+*   lg2cv  ln2, log10(2), spx
+*   fopi   4/pi, 256 bits from 2^0 down, after one zero long
+*   sctb   sin(k/32), cos(k/32), k = 1..25, Q0.32
+*   attb   atan(k/16), k = 1..16, Q2.62
+*   athtb  atanh(2^-i), i = 1..31, 4 and 13 twice, Q2.62
+*   q2hki  1/K, K = prod sqrt(1 - 4^-i), first 18 steps
+*   Values are rounded to nearest from 256-bit sums; the
+*   4/pi bits are exact (truncated).
+*   The tables are read only and sit in the text section,
+*   so the library may be put in ROM.
+*-----------------------------------------------------------
+* Copyright 2025 John J Lovrinic, MIT License (see LICENSE)
+*-----------------------------------------------------------
+    .globl      _atntb
+    .globl      _q2pi2
+    .globl      _exptb
+    .globl      _lg2tb
+    .globl      _lg2pc
+    .globl      _lg2cv
+    .globl      _fopi
+    .globl      _sctb
+    .globl      _attb
+    .globl      _athtb
+    .globl      _q2hki
+
+    .text
+    .even
+_atntb:
+    .dc.l   $3243F6A8,$885A308D   ; atan(2^-0)
+    .dc.l   $1DAC6705,$61BB4F69   ; atan(2^-1)
+    .dc.l   $0FADBAFC,$96406EB1   ; atan(2^-2)
+    .dc.l   $07F56EA6,$AB0BDB72   ; atan(2^-3)
+    .dc.l   $03FEAB76,$E59FBD39   ; atan(2^-4)
+    .dc.l   $01FFD55B,$BA97624B   ; atan(2^-5)
+    .dc.l   $00FFFAAA,$DDDB94D6   ; atan(2^-6)
+    .dc.l   $007FFF55,$56EEEA5D   ; atan(2^-7)
+    .dc.l   $003FFFEA,$AAB7776E   ; atan(2^-8)
+    .dc.l   $001FFFFD,$5555BBBC   ; atan(2^-9)
+    .dc.l   $000FFFFF,$AAAAADDE   ; atan(2^-10)
+    .dc.l   $0007FFFF,$F555556F   ; atan(2^-11)
+    .dc.l   $0003FFFF,$FEAAAAAB   ; atan(2^-12)
+    .dc.l   $0001FFFF,$FFD55555   ; atan(2^-13)
+    .dc.l   $0000FFFF,$FFFAAAAB   ; atan(2^-14)
+    .dc.l   $00007FFF,$FFFF5555   ; atan(2^-15)
+    .dc.l   $00003FFF,$FFFFEAAB   ; atan(2^-16)
+    .dc.l   $00001FFF,$FFFFFD55   ; atan(2^-17)
+    .dc.l   $00000FFF,$FFFFFFAB   ; atan(2^-18)
+    .dc.l   $000007FF,$FFFFFFF5   ; atan(2^-19)
+    .dc.l   $000003FF,$FFFFFFFF   ; atan(2^-20)
+    .dc.l   $00000200,$00000000   ; atan(2^-21)
+    .dc.l   $00000100,$00000000   ; atan(2^-22)
+    .dc.l   $00000080,$00000000   ; atan(2^-23)
+    .dc.l   $00000040,$00000000   ; atan(2^-24)
+    .dc.l   $00000020,$00000000   ; atan(2^-25)
+    .dc.l   $00000010,$00000000   ; atan(2^-26)
+    .dc.l   $00000008,$00000000   ; atan(2^-27)
+    .dc.l   $00000004,$00000000   ; atan(2^-28)
+    .dc.l   $00000002,$00000000   ; atan(2^-29)
+    .dc.l   $00000001,$00000000   ; atan(2^-30)
+    .dc.l   $00000000,$80000000   ; atan(2^-31)
+_q2pi2:
+    .dc.l   $6487ED51,$10B4611A   ; pi/2
+_exptb:
+    .dc.w   0,0
+    .dc.l   $80000000             ; 1/0!
+    .dc.w   0,0
+    .dc.l   $80000000             ; 1/1!
+    .dc.w   0,-1
+    .dc.l   $80000000             ; 1/2!
+    .dc.w   0,-3
+    .dc.l   $AAAAAAAB             ; 1/3!
+    .dc.w   0,-5
+    .dc.l   $AAAAAAAB             ; 1/4!
+    .dc.w   0,-7
+    .dc.l   $88888889             ; 1/5!
+    .dc.w   0,-10
+    .dc.l   $B60B60B6             ; 1/6!
+    .dc.w   0,-13
+    .dc.l   $D00D00D0             ; 1/7!
+    .dc.w   0,-16
+    .dc.l   $D00D00D0             ; 1/8!
+    .dc.w   0,-19
+    .dc.l   $B8EF1D2B             ; 1/9!
+    .dc.w   0,-22
+    .dc.l   $93F27DBC             ; 1/10!
+_lg2tb:
+    .dc.w   0,0
+    .dc.l   $B2000000             ; 178/128
+    .dc.w   -1,-2
+    .dc.l   $F393550F             ; -log2(178/128)
+    .dc.w   0,0
+    .dc.l   $AB000000             ; 171/128
+    .dc.w   -1,-2
+    .dc.l   $D5F0C3CC             ; -log2(171/128)
+    .dc.w   0,0
+    .dc.l   $A4000000             ; 164/128
+    .dc.w   -1,-2
+    .dc.l   $B7110E6D             ; -log2(164/128)
+    .dc.w   0,0
+    .dc.l   $9E000000             ; 158/128
+    .dc.w   -1,-2
+    .dc.l   $9B892675             ; -log2(158/128)
+    .dc.w   0,0
+    .dc.l   $98000000             ; 152/128
+    .dc.w   -1,-3
+    .dc.l   $FDE0B5C8             ; -log2(152/128)
+    .dc.w   0,0
+    .dc.l   $92000000             ; 146/128
+    .dc.w   -1,-3
+    .dc.l   $C2615E81             ; -log2(146/128)
+    .dc.w   0,0
+    .dc.l   $8D000000             ; 141/128
+    .dc.w   -1,-3
+    .dc.l   $8EE68CBB             ; -log2(141/128)
+    .dc.w   0,0
+    .dc.l   $89000000             ; 137/128
+    .dc.w   -1,-4
+    .dc.l   $C8C50B72             ; -log2(137/128)
+    .dc.w   0,0
+    .dc.l   $84000000             ; 132/128
+    .dc.w   -1,-5
+    .dc.l   $B5D69BAC             ; -log2(132/128)
+    .dc.w   0,0
+    .dc.l   $80000000             ; 128/128
+    .dc.w   0,-16384
+    .dc.l   $00000000             ; -log2(128/128)
+    .dc.w   0,-1
+    .dc.l   $F8000000             ; 124/128
+    .dc.w   0,-5
+    .dc.l   $BB9CA64F             ; -log2(124/128)
+    .dc.w   0,-1
+    .dc.l   $F0000000             ; 120/128
+    .dc.w   0,-4
+    .dc.l   $BEB024B6             ; -log2(120/128)
+    .dc.w   0,-1
+    .dc.l   $EA000000             ; 117/128
+    .dc.w   0,-3
+    .dc.l   $84BF1C67             ; -log2(117/128)
+    .dc.w   0,-1
+    .dc.l   $E4000000             ; 114/128
+    .dc.w   0,-3
+    .dc.l   $AB1EE150             ; -log2(114/128)
+    .dc.w   0,-1
+    .dc.l   $DE000000             ; 111/128
+    .dc.w   0,-3
+    .dc.l   $D284A5AA             ; -log2(111/128)
+    .dc.w   0,-1
+    .dc.l   $D8000000             ; 108/128
+    .dc.w   0,-3
+    .dc.l   $FAFEC548             ; -log2(108/128)
+    .dc.w   0,-1
+    .dc.l   $D2000000             ; 105/128
+    .dc.w   0,-2
+    .dc.l   $924E6959             ; -log2(105/128)
+    .dc.w   0,-1
+    .dc.l   $CC000000             ; 102/128
+    .dc.w   0,-2
+    .dc.l   $A7B7DD96             ; -log2(102/128)
+    .dc.w   0,-1
+    .dc.l   $C8000000             ; 100/128
+    .dc.w   0,-2
+    .dc.l   $B6587B43             ; -log2(100/128)
+    .dc.w   0,-1
+    .dc.l   $C4000000             ; 98/128
+    .dc.w   0,-2
+    .dc.l   $C544C056             ; -log2(98/128)
+    .dc.w   0,-1
+    .dc.l   $BE000000             ; 95/128
+    .dc.w   0,-2
+    .dc.l   $DC3BE2BE             ; -log2(95/128)
+    .dc.w   0,-1
+    .dc.l   $BA000000             ; 93/128
+    .dc.w   0,-2
+    .dc.l   $EBF36056             ; -log2(93/128)
+    .dc.w   0,-1
+    .dc.l   $B6000000             ; 91/128
+    .dc.w   0,-2
+    .dc.l   $FC025747             ; -log2(91/128)
+_lg2pc:
+    .dc.w   0,0
+    .dc.l   $B8AA3B29             ; 1/(1 ln2)
+    .dc.w   -1,-1
+    .dc.l   $B8AA3B29             ; -1/(2 ln2)
+    .dc.w   0,-2
+    .dc.l   $F6384EE2             ; 1/(3 ln2)
+    .dc.w   -1,-2
+    .dc.l   $B8AA3B29             ; -1/(4 ln2)
+    .dc.w   0,-2
+    .dc.l   $93BB6287             ; 1/(5 ln2)
+    .dc.w   -1,-3
+    .dc.l   $F6384EE2             ; -1/(6 ln2)
+_lg2cv:
+    .dc.w   0,-1
+    .dc.l   $B17217F8             ; ln2
+    .dc.w   0,-2
+    .dc.l   $9A209A85             ; log10(2)
+_fopi:
+    .dc.l   $00000000
+    .dc.l   $A2F9836E
+    .dc.l   $4E441529
+    .dc.l   $FC2757D1
+    .dc.l   $F534DDC0
+    .dc.l   $DB629599
+    .dc.l   $3C439041
+    .dc.l   $FE5163AB
+    .dc.l   $DEBBC561
+_sctb:
+    .dc.l   $07FFAAAC,$FFE000AB   ; sin, cos 1/32
+    .dc.l   $0FFD5577,$FF800AAA   ; sin, cos 2/32
+    .dc.l   $17F70103,$FEE035FC   ; sin, cos 3/32
+    .dc.l   $1FEAAEEF,$FE00AA94   ; sin, cos 4/32
+    .dc.l   $27D66259,$FCE1A054   ; sin, cos 5/32
+    .dc.l   $2FB8205F,$FB835EFD   ; sin, cos 6/32
+    .dc.l   $378DF09E,$F9E63E1E   ; sin, cos 7/32
+    .dc.l   $3F55DDAA,$F80AA4FC   ; sin, cos 8/32
+    .dc.l   $470DF593,$F5F10A7C   ; sin, cos 9/32
+    .dc.l   $4EB44A5E,$F399F501   ; sin, cos 10/32
+    .dc.l   $5646F27F,$F105FA4D   ; sin, cos 11/32
+    .dc.l   $5DC40956,$EE35BF5D   ; sin, cos 12/32
+    .dc.l   $6529AFA8,$EB29F83A   ; sin, cos 13/32
+    .dc.l   $6C760C15,$E7E367D3   ; sin, cos 14/32
+    .dc.l   $73A74B8F,$E462DFC6   ; sin, cos 15/32
+    .dc.l   $7ABBA1D1,$E0A94033   ; sin, cos 16/32
+    .dc.l   $81B149CE,$DCB7777B   ; sin, cos 17/32
+    .dc.l   $88868626,$D88E820B   ; sin, cos 18/32
+    .dc.l   $8F39A192,$D42F6A1C   ; sin, cos 19/32
+    .dc.l   $95C8EF54,$CF9B476D   ; sin, cos 20/32
+    .dc.l   $9C32CBA3,$CAD33F00   ; sin, cos 21/32
+    .dc.l   $A2759C0E,$C5D882D3   ; sin, cos 22/32
+    .dc.l   $A88FCFEC,$C0AC518D   ; sin, cos 23/32
+    .dc.l   $AE7FE0B6,$BB4FF633   ; sin, cos 24/32
+    .dc.l   $B4445271,$B5C4C7D5   ; sin, cos 25/32
+_attb:
+    .dc.l   $03FEAB76,$E59FBD39   ; atan(1/16)
+    .dc.l   $07F56EA6,$AB0BDB72   ; atan(2/16)
+    .dc.l   $0BDCBDA5,$E72D8113   ; atan(3/16)
+    .dc.l   $0FADBAFC,$96406EB1   ; atan(4/16)
+    .dc.l   $13627737,$07EBCBCD   ; atan(5/16)
+    .dc.l   $16F61941,$E4DEF08E   ; atan(6/16)
+    .dc.l   $1A64EEC3,$CC23FCB7   ; atan(7/16)
+    .dc.l   $1DAC6705,$61BB4F69   ; atan(8/16)
+    .dc.l   $20CAFD29,$B6619F8B   ; atan(9/16)
+    .dc.l   $23C01757,$BDFD67E7   ; atan(10/16)
+    .dc.l   $268BE039,$9C6F7688   ; atan(11/16)
+    .dc.l   $292F1F46,$4D3DC249   ; atan(12/16)
+    .dc.l   $2BAB130E,$2D363020   ; atan(13/16)
+    .dc.l   $2E014F8A,$F08C679D   ; atan(14/16)
+    .dc.l   $3033A16E,$2B149990   ; atan(15/16)
+    .dc.l   $3243F6A8,$885A308D   ; atan(16/16)
+_athtb:
+    .dc.l   $2327D4F5,$5A06152F   ; atanh(2^-1)
+    .dc.l   $1058AEFA,$811451A7   ; atanh(2^-2)
+    .dc.l   $080AC48E,$4F577BB5   ; atanh(2^-3)
+    .dc.l   $04015622,$B4DD6B37   ; atanh(2^-4)
+    .dc.l   $04015622,$B4DD6B37   ; atanh(2^-4)
+    .dc.l   $02002AB1,$1235DC49   ; atanh(2^-5)
+    .dc.l   $01000555,$888AD1CA   ; atanh(2^-6)
+    .dc.l   $008000AA,$AC4448D7   ; atanh(2^-7)
+    .dc.l   $00400015,$5562222B   ; atanh(2^-8)
+    .dc.l   $00200002,$AAAB1111   ; atanh(2^-9)
+    .dc.l   $00100000,$55555889   ; atanh(2^-10)
+    .dc.l   $00080000,$0AAAAAC4   ; atanh(2^-11)
+    .dc.l   $00040000,$01555556   ; atanh(2^-12)
+    .dc.l   $00020000,$002AAAAB   ; atanh(2^-13)
+    .dc.l   $00020000,$002AAAAB   ; atanh(2^-13)
+    .dc.l   $00010000,$00055555   ; atanh(2^-14)
+    .dc.l   $00008000,$0000AAAB   ; atanh(2^-15)
+    .dc.l   $00004000,$00001555   ; atanh(2^-16)
+    .dc.l   $00002000,$000002AB   ; atanh(2^-17)
+    .dc.l   $00001000,$00000055   ; atanh(2^-18)
+    .dc.l   $00000800,$0000000B   ; atanh(2^-19)
+    .dc.l   $00000400,$00000001   ; atanh(2^-20)
+    .dc.l   $00000200,$00000000   ; atanh(2^-21)
+    .dc.l   $00000100,$00000000   ; atanh(2^-22)
+    .dc.l   $00000080,$00000000   ; atanh(2^-23)
+    .dc.l   $00000040,$00000000   ; atanh(2^-24)
+    .dc.l   $00000020,$00000000   ; atanh(2^-25)
+    .dc.l   $00000010,$00000000   ; atanh(2^-26)
+    .dc.l   $00000008,$00000000   ; atanh(2^-27)
+    .dc.l   $00000004,$00000000   ; atanh(2^-28)
+    .dc.l   $00000002,$00000000   ; atanh(2^-29)
+    .dc.l   $00000001,$00000000   ; atanh(2^-30)
+    .dc.l   $00000000,$80000000   ; atanh(2^-31)
+_q2hki:
+    .dc.l   $4D47A1C7,$F6D9C329   ; 1/K
@@ -0,0 +1,66 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+
+/* spxtest.c - spx chain spot checks (extra bits, wide exponent, one rounding, flags) */
+
+#define P2M30   0x30800000L     /* 2^-30 */
+#define P2M31   0x30000000L     /* 2^-31 */
+#define P2M32   0x2f800000L     /* 2^-32 */
+#define P2127   0x7f000000L     /* 2^127 */
+#define P2126   0x7e800000L     /* 2^126 */
+
+long    bad;
+
+void    check(lbl, res, want)
+char    *lbl;
+spf     res;
+spf     want;
+{
+        printf("%-28s %08lX  %s\n", lbl, res, (res==want) ? "ok" : "FAIL");
+        if(res!=want) bad++;
+}
+
+void    main()
+{
+spx     a;
+spx     b;
+spx     t;
+
+        bad=0L;
+        fpspx(&a, spfpi);
+        check("pi round trip", spx_fp(&a), spfpi);
+        fpspx(&a, spfone);
+        fpspx(&b, 0x40400000L);
+        spxdiv(&t, &a, &b);
+        spxmul(&t, &t, &b);
+        check("(1/3)*3", spx_fp(&t), spfone);
+        fpspx(&b, P2M30);
+        spxadd(&t, &a, &b);             /* 1 + 2^-30 needs more than 24 bits */
+        spxsub(&t, &t, &a);
+        check("(1+2^-30)-1", spx_fp(&t), P2M30);
+        fpspx(&b, P2M32);
+        spxadd(&t, &a, &b);             /* half the last bit: rounds up */
+        spxsub(&t, &t, &a);
+        check("(1+2^-32)-1", spx_fp(&t), P2M31);
+        fpspx(&a, P2127);
+        spxmul(&t, &a, &a);             /* 2^254 is past spf but inside spx */
+        spxdiv(&t, &t, &a);
+        fpspx(&b, spfhlf);
+        spxmul(&t, &t, &b);
+        check("2^127*2^127/2^127/2", spx_fp(&t), P2126);
+        /* sticky flags */
+        spfclr(SPFALL);
+        spxmul(&t, &a, &a);
+        if(spftst(SPFALL)!=0L) { printf("spxmul raised %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        check("2^254 to spf", spx_fp(&t), 0x7f800000L);
+        if(spftst(SPFALL)!=(SPFOVF|SPFINX)) { printf("overflow flags %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        spfclr(SPFALL);
+        fpspx(&a, spfone);
+        fpspx(&b, spfz);
+        spxdiv(&t, &a, &b);
+        check("1/0", spx_fp(&t), 0x7f800000L);
+        if(spftst(SPFALL)!=SPFDZ) { printf("1/0 flags %lX  FAIL\n",spftst(SPFALL)); bad++; }
+        spfclr(SPFALL);
+        printf("done, %ld failures\n",bad);
+}
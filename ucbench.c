@@ -0,0 +1,87 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* ucbench.c - the unchecked entry points against the checked calls    */
+/*   spfscu, spflnu and spfexu must give what spfsc, spfln and spfexp  */
+/*   give over a sweep of their domains ([0, pi/4] clear of spfsc's    */
+/*   locks at 0, pi/6 and pi/4, [1, 2) and [0, 1)).  Then each runs    */
+/*   NREP times; time the pairs between the go/end lines.              */
+
+#define NSWP    64L
+#define NREP    200L
+#define C_PI4   0x3f490fdbL     /* pi/4 */
+
+long    bad;
+
+void    same(lbl, n)
+char    *lbl;
+long    n;
+{
+        printf("%-8s %s\n", lbl, (n==0L) ? "ok" : "FAIL");
+        if(n!=0L) bad++;
+}
+
+void    main()
+{
+spf     a;
+spf     da;
+spf     s;
+spf     c;
+spf     su;
+spf     cu;
+long    i;
+long    k;
+
+        bad=0L;
+        da=spfdiv(C_PI4,spfltf(NSWP));
+        a=da;
+        k=0L;
+        for(i=1L;i<NSWP;i++) {
+                spfsc(a,&s,&c);
+                spfscu(a,&su,&cu);
+                if(s!=su || c!=cu) k++;
+                a=spfadd(a,da);
+        }
+        same("spfscu",k);
+        da=spfdiv(spfone,spfltf(NSWP));
+        a=spfone;
+        k=0L;
+        for(i=0L;i<NSWP;i++) {
+                if(spfln(a)!=spflnu(a)) k++;
+                a=spfadd(a,da);
+        }
+        same("spflnu",k);
+        a=spfz;
+        k=0L;
+        for(i=0L;i<NSWP;i++) {
+                if(spfexp(a)!=spfexu(a)) k++;
+                a=spfadd(a,da);
+        }
+        same("spfexu",k);
+        printf("done, %ld failures\n",bad);
+
+        /* timing */
+        a=0x3f060000L;                  /* just below pi/6 */
+        go("spfsc");
+        for(k=0L;k<NREP;k++) spfsc(a,&s,&c);
+        end();
+        go("spfscu");
+        for(k=0L;k<NREP;k++) spfscu(a,&s,&c);
+        end();
+        a=0x3fc00000L;                  /* 1.5 */
+        go("spfln");
+        for(k=0L;k<NREP;k++) s=spfln(a);
+        end();
+        go("spflnu");
+        for(k=0L;k<NREP;k++) s=spflnu(a);
+        end();
+        a=0x3f000000L;                  /* 0.5 */
+        go("spfexp");
+        for(k=0L;k<NREP;k++) s=spfexp(a);
+        end();
+        go("spfexu");
+        for(k=0L;k<NREP;k++) s=spfexu(a);
+        end();
+}
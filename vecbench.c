@@ -0,0 +1,120 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <spflib.h>
+#include <spfbch.h>
+
+/* vecbench.c - spfvec results against scalar loops, and timing runs */
+/*   Each op runs NREP times over NVEC elements, first as spfvec, then  */
+/*   as the same loop in C.  Time the pairs between the go/end lines.   */
+/*   Per-element cycles (simulator) are listed in the spfvec.s header.  */
+
+#define NVEC    64
+#define NREP    200L
+#define C_01    0x3c23d70aL     /* 0.01 */
+
+spf     va[NVEC];
+spf     vb[NVEC];
+spf     vr[NVEC];
+spf     sr[NVEC];
+long    seed;
+long    bad;
+
+void    vecset()
+{
+long    i;
+
+        seed=12345L;
+        for(i=0L;i<NVEC;i++) {
+                seed=seed*1103515245L+12345L;
+                va[i]=spfmul(spfltf((seed>>8)%2001L-1000L),C_01);
+                seed=seed*1103515245L+12345L;
+                vb[i]=spfmul(spfltf((seed>>8)%2001L-1000L),C_01);
+        }
+}
+
+void    same(lbl)
+char    *lbl;
+{
+long    i;
+long    n;
+
+        n=0L;
+        for(i=0L;i<NVEC;i++) if(vr[i]!=sr[i]) n++;
+        printf("%-8s %s\n", lbl, (n==0L) ? "ok" : "FAIL");
+        if(n!=0L) bad++;
+}
+
+void    main()
+{
+spf     s;
+spf     t;
+long    i;
+long    k;
+long    m;
+
+        vecset();
+        bad=0L;
+        /* results: element-wise ops match the scalar calls bit for bit */
+        spvadd(vr,va,vb,(long)NVEC);
+        for(i=0L;i<NVEC;i++) sr[i]=spfadd(va[i],vb[i]);
+        same("spvadd");
+        spvsub(vr,va,vb,(long)NVEC);
+        for(i=0L;i<NVEC;i++) sr[i]=spfsub(va[i],vb[i]);
+        same("spvsub");
+        spvmul(vr,va,vb,(long)NVEC);
+        for(i=0L;i<NVEC;i++) sr[i]=spfmul(va[i],vb[i]);
+        same("spvmul");
+        spvscl(vr,va,spfpi,(long)NVEC);
+        for(i=0L;i<NVEC;i++) sr[i]=spfmul(va[i],spfpi);
+        same("spvscl");
+        m=0L;
+        for(i=1L;i<NVEC;i++) if(spfgt(va[i],va[m])) m=i;
+        k=spvamx(va,(long)NVEC);
+        printf("spvamx   %ld %ld  %s\n", k, m, (k==m) ? "ok" : "FAIL");
+        if(k!=m) bad++;
+        s=va[0];
+        for(i=1L;i<NVEC;i++) if(spflt(va[i],s)) s=va[i];
+        t=spvmin(va,(long)NVEC);
+        printf("spvmin   %08lX %08lX  %s\n", t, s, (t==s) ? "ok" : "FAIL");
+        if(t!=s) bad++;
+        /* sums round once, so they may differ from the scalar loop in the last bits */
+        s=spfz;
+        for(i=0L;i<NVEC;i++) s=spfadd(s,spfmul(va[i],vb[i]));
+        printf("spvdot   %08lX  scalar %08lX\n", spvdot(va,vb,(long)NVEC), s);
+        s=spfz;
+        for(i=0L;i<NVEC;i++) s=spfadd(s,va[i]);
+        printf("spvsum   %08lX  scalar %08lX\n", spvsum(va,(long)NVEC), s);
+        printf("done, %ld failures\n",bad);
+
+        /* timing */
+        go("spvadd");
+        for(k=0L;k<NREP;k++) spvadd(vr,va,vb,(long)NVEC);
+        end();
+        go("scalar");
+        for(k=0L;k<NREP;k++) for(i=0L;i<NVEC;i++) sr[i]=spfadd(va[i],vb[i]);
+        end();
+        go("spvmul");
+        for(k=0L;k<NREP;k++) spvmul(vr,va,vb,(long)NVEC);
+        end();
+        go("scalar");
+        for(k=0L;k<NREP;k++) for(i=0L;i<NVEC;i++) sr[i]=spfmul(va[i],vb[i]);
+        end();
+        go("spvdot");
+        for(k=0L;k<NREP;k++) s=spvdot(va,vb,(long)NVEC);
+        end();
+        go("scalar");
+        for(k=0L;k<NREP;k++) {
+                s=spfz;
+                for(i=0L;i<NVEC;i++) s=spfadd(s,spfmul(va[i],vb[i]));
+        }
+        end();
+        go("spvmax");
+        for(k=0L;k<NREP;k++) s=spvmax(va,(long)NVEC);
+        end();
+        go("scalar");
+        for(k=0L;k<NREP;k++) {
+                s=va[0];
+                for(i=1L;i<NVEC;i++) if(spfgt(va[i],s)) s=va[i];
+        }
+        end();
+}